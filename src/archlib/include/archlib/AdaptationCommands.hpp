@@ -0,0 +1,31 @@
+#ifndef ADAPTATIONCOMMANDS_HPP
+#define ADAPTATIONCOMMANDS_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "archlib/AdaptationCommand.h"
+#include "archlib/AdaptationCommandSet.h"
+
+namespace arch {
+
+    // Appends param=value to the parameters the command sets
+    void addParameter(archlib::AdaptationCommand &msg, const uint8_t &param, const double &value);
+
+    // Sets the parameters of from in into, the values of from win
+    void merge(archlib::AdaptationCommand &into, const archlib::AdaptationCommand &from);
+
+    // One command per target, with the latest value of every parameter set to
+    // it in the batch; targets keep the order in which they first appear
+    std::vector<archlib::AdaptationCommand> coalesce(const archlib::AdaptationCommandSet &set);
+
+    // "freq", "replicate_collect", ... as the parameters are named in the logs
+    std::string parameterName(const uint8_t &param);
+
+    // "freq=1.300000,replicate_collect=3", the text form the logger persists
+    std::string toString(const archlib::AdaptationCommand &msg);
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef LOOPSCHEDULER_HPP
+#define LOOPSCHEDULER_HPP
+
+#include <string>
+#include <stdint.h>
+
+#include "ros/ros.h"
+
+namespace arch {
+
+    /*
+     * Paces a periodic loop on absolute deadlines: cycle k is released
+     * at start + k * period, however long the cycles before it took, so
+     * the loop keeps its frequency without drifting. A new frequency
+     * takes effect at once, the next deadline is the release of the
+     * current cycle plus the new period.
+     *
+     * A cycle that ends after its deadline is an overrun. With SKIP, the
+     * deadlines that went by are dropped and the next cycle starts right
+     * away from the latest of them, so the loop keeps its phase; with
+     * CATCH_UP, the late cycles run back to back until the loop is on
+     * time again.
+     *
+     * Deadlines follow ros::Time, so /clock under simulated time.
+     */
+    class LoopScheduler {
+
+        public:
+            enum OverrunPolicy { SKIP, CATCH_UP };
+
+            LoopScheduler();
+
+        private:
+            LoopScheduler(const LoopScheduler &);
+            LoopScheduler &operator=(const LoopScheduler &);
+
+        public:
+            // frequencies that are not positive are ignored
+            void setFreq(const double &freq);
+            double getFreq() const;
+
+            void setPolicy(const OverrunPolicy &policy);
+            // "skip" or "catch_up", throws std::invalid_argument otherwise
+            static OverrunPolicy parsePolicy(const std::string &policy);
+
+            // when the current cycle is due to end
+            ros::Time deadline();
+            // sleeps until the deadline, false if it was already missed
+            bool sleep();
+
+            // since the last reset
+            uint64_t getCycles() const;
+            uint64_t getOverruns() const;
+            uint64_t getSkipped() const;
+            // how late the loop woke up after its deadlines (s)
+            double meanJitter() const;
+            double maxJitter() const;
+            void resetStats();
+
+        private:
+            double freq;
+            ros::Duration period;
+            OverrunPolicy policy;
+
+            // release time of the current cycle, zero before the first one
+            ros::Time release;
+
+            uint64_t cycles;
+            uint64_t overruns;
+            uint64_t skipped;
+            uint64_t woken;
+            double jitter;
+            double max_jitter;
+    };
+
+}
+
+#endif
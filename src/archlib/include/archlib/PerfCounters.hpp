@@ -0,0 +1,110 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace arch {
+
+    /*
+     * Histogram of durations in ns, log-linear in the manner of
+     * HdrHistogram: every power of two is split into 8 buckets, so a
+     * percentile is off by 12.5% of its value at most, whatever the
+     * scale. Counts are relaxed atomics written by a single thread, so
+     * they can be read from any other one while they are recorded.
+     */
+    class Histogram {
+
+        public:
+            static const size_t sub_buckets = 8;
+            static const size_t buckets = 62 * sub_buckets;
+
+            Histogram();
+
+        private:
+            Histogram(const Histogram &);
+            Histogram &operator=(const Histogram &);
+
+        public:
+            void record(const uint64_t &ns);
+            // counts of every bucket and the sum of the values so far
+            void read(std::vector<uint64_t> &counts, uint64_t &sum) const;
+
+            static size_t bucket(const uint64_t &ns);
+            // smallest value of the next bucket, an upper bound on the values of b
+            static uint64_t upper(const size_t &b);
+            // upper bound of the value at quantile q (in [0,1]) of counts
+            static uint64_t percentile(const std::vector<uint64_t> &counts, const double &q);
+
+        private:
+            std::array<std::atomic<uint64_t>, buckets> counts;
+            std::atomic<uint64_t> sum;
+    };
+
+    /*
+     * Counters of the cycles of a component: how long each phase of a
+     * cycle takes, how many cycles ran over their period and how many
+     * left callbacks waiting. The loop marks the phases as it enters
+     * them, while report() gives what happened since the last report.
+     */
+    class PerfCounters {
+
+        public:
+            typedef std::chrono::steady_clock Clock;
+
+            enum Phase { SPIN, BODY, SLEEP, PHASES };
+
+            struct Summary {
+                double mean, p50, p99, max;     // s
+            };
+
+            struct Report {
+                uint64_t cycles;
+                uint64_t overruns;
+                uint64_t backlogged;
+                std::array<Summary, PHASES> phases;
+            };
+
+            PerfCounters();
+
+        private:
+            PerfCounters(const PerfCounters &);
+            PerfCounters &operator=(const PerfCounters &);
+
+        public:
+            static const char *name(const Phase &phase);
+
+            // the cycle enters phase, the first mark after endCycle starts the next one
+            void mark(const Phase &phase);
+            // callbacks were still waiting once the queue was spun
+            void backlog(const bool &pending);
+            // closes the cycle, that should have taken period s
+            void endCycle(const double &period);
+
+            void report(Report &report);
+
+        private:
+            Histogram histograms[PHASES];
+            std::atomic<uint64_t> cycles;
+            std::atomic<uint64_t> overruns;
+            std::atomic<uint64_t> backlogged;
+
+            // state of the writer
+            Phase phase;
+            Clock::time_point since;
+            Clock::time_point cycle_start;
+            bool running;
+
+            // state of the reader
+            std::vector<uint64_t> last_counts[PHASES];
+            uint64_t last_sum[PHASES];
+            uint64_t last_cycles, last_overruns, last_backlogged;
+    };
+
+}
+
+#endif
@@ -1,18 +1,26 @@
 #ifndef ROSCOMPONENT_HPP
 #define ROSCOMPONENT_HPP
 
+#include <fstream>
 #include <string>
 #include <stdexcept>
 
 #include "ros/ros.h"
 
 #include "archlib/ROSComponentDescriptor.hpp"
+#include "archlib/PerfCounters.hpp"
+#include "archlib/LoopScheduler.hpp"
+#include "archlib/Performance.h"
+#include "archlib/Tracer.hpp"
+#include "archlib/Wakeup.h"
 
 namespace arch {
     class ROSComponent{
 
         public:
             ROSComponent(int &argc, char **argv, const std::string &name);
+            // hosts the component inside a process that already called ros::init
+            ROSComponent(const std::string &name);
 		    virtual ~ROSComponent();
 
         private:
@@ -29,6 +37,52 @@ namespace arch {
             ROSComponentDescriptor rosComponentDescriptor;    
 
             static std::string getRosNodeName(const std::string& node_name, const std::string& node_namespace);
+
+            // looks the parameter up on the node first (~key), then in its namespace,
+            // so that nodes launched together can each have their own frequency
+            template<class T>
+            bool getParam(const std::string &key, T &value) const {
+                return ros::NodeHandle("~").getParam(key, value) || ros::param::get(key, value);
+            }
+
+            // blocks until the service is advertised, instead of sleeping for a
+            // while before calling it; false if it is still missing after
+            // startup_timeout s (30 by default, 0 to wait for ever)
+            bool waitForService(const std::string &service) const;
+
+            // under simulated time (/use_sim_time), tells the simulation clock
+            // that this component sleeps until deadline
+            void scheduleWakeup(const ros::Time &deadline);
+
+            // paces the cycles at the frequency of the descriptor, which can change
+            // between two cycles; overruns are handled as the overrun_policy
+            // parameter says ("skip" by default, or "catch_up")
+            LoopScheduler loop;
+            // ends the cycle: sleeps until the deadline of the loop
+            void waitNextCycle();
+
+            // records the hops of the traces that pass through this component
+            Tracer tracer;
+
+            // the loop marks the phases of its cycles in perf and closes every
+            // cycle with endCycle, which reports them on diagnostics every
+            // diagnostics_period s (10 by default, 0 for never) and appends
+            // them to <diagnostics_dir>/<node>.perf if that parameter is set
+            PerfCounters perf;
+            void endCycle(const double &freq);
+
+        private:
+            // reads the parameters of the loop and the counters, once ros is up
+            void configure();
+            void reportPerformance(const ros::Time &now);
+
+            ros::Publisher wakeup;
+
+            ros::Publisher diagnostics;
+            std::ofstream perf_file;
+            bool configured;
+            double perf_period;
+            ros::Time last_report;
     };
 }
 
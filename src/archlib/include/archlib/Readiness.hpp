@@ -0,0 +1,59 @@
+#ifndef READINESS_HPP
+#define READINESS_HPP
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <boost/bind.hpp>
+
+#include "ros/ros.h"
+#include "ros/callback_queue.h"
+
+namespace arch {
+
+    /*
+     * Publishers that can be waited on until someone subscribes to them.
+     *
+     * Their connection callbacks go to a queue of their own, so wait()
+     * sleeps on that queue and wakes up as soon as a subscriber connects,
+     * instead of polling getNumSubscribers. The checks in between back
+     * off from 1 ms to 100 ms, in case a connection is counted after its
+     * callback has run.
+     */
+    class Readiness {
+
+        public:
+            Readiness();
+            ~Readiness();
+
+        private:
+            Readiness(const Readiness &);
+            Readiness &operator=(const Readiness &);
+
+        public:
+            template<class M>
+            ros::Publisher advertise(const std::string &topic, const uint32_t &queue_size) {
+                ros::Publisher pub = handle.advertise<M>(topic, queue_size, boost::bind(&Readiness::connected, this, _1));
+                publishers.push_back(pub);
+                return pub;
+            }
+
+            // true once every publisher has a subscriber, false if it takes
+            // longer than timeout (none for a zero timeout) or ros shuts down
+            bool wait(const ros::WallDuration &timeout);
+
+            // topics that still have no subscriber
+            std::vector<std::string> pending() const;
+
+        private:
+            void connected(const ros::SingleSubscriberPublisher &);
+            bool ready() const;
+
+            ros::CallbackQueue queue;
+            ros::NodeHandle handle;
+            std::vector<ros::Publisher> publishers;
+    };
+
+}
+
+#endif
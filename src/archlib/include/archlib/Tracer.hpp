@@ -0,0 +1,54 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <fstream>
+#include <string>
+#include <stdint.h>
+
+#include "ros/ros.h"
+#include "std_msgs/Header.h"
+
+namespace arch {
+
+    /*
+     * Follows a status of a sensor around the MAPE-K loop, up to the
+     * reconfigurations it led to.
+     *
+     * The id of a trace travels in the frame_id of the headers of the
+     * messages and every node it passes through appends a record
+     *     trace,hop,node,time (ns)
+     * to its own file <trace_dir>/<node>.trace, flushed after every
+     * record (after the time is taken). Tracing is off, and costs
+     * nothing, unless the trace_dir parameter is set.
+     */
+    class Tracer {
+
+        public:
+            Tracer();
+            ~Tracer();
+
+        private:
+            Tracer(const Tracer &);
+            Tracer &operator=(const Tracer &);
+
+        public:
+            void setNode(const std::string &node);
+            bool enabled();
+
+            // gives header a new trace, that starts at hop
+            void start(std_msgs::Header &header, const std::string &hop);
+            void record(const std_msgs::Header &header, const std::string &hop);
+            void record(const std::string &trace, const std::string &hop);
+
+        private:
+            void open();
+
+            std::string node;
+            bool opened;
+            uint64_t count;
+            std::ofstream file;
+    };
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define COMPONENT_HPP
 
 #include <string>
+#include <algorithm>
 #include <signal.h>
 
 #include "ros/ros.h"
@@ -13,6 +14,7 @@
 #include "archlib/EffectorRegister.h"
 
 #include "archlib/ROSComponent.hpp"
+#include "archlib/Readiness.hpp"
 
 namespace arch {
     namespace target_system {
@@ -21,6 +23,7 @@ namespace arch {
 
             public:
                 Component(int &argc, char **argv, const std::string &name);
+                Component(const std::string &name);
                 virtual ~Component();
 
             private:
@@ -42,17 +45,30 @@ namespace arch {
             protected:
                 void activate();
                 void deactivate();
-                static void shutdownComponent();
+                void detach();
+                // false once ROS is down or the process got SIGINT
+                bool running() const;
+
+                // accounts for a reconfiguration sent at the stamp of its header,
+                // to measure the actuation latency of the adaptation loop
+                void recordActuation(const std_msgs::Header &header);
 
                 ros::NodeHandle handle;
                 static void sigIntHandler(int signal);
+                static volatile sig_atomic_t interrupted;
 
             private:
                 bool status;
+                // waits for the probe, it outlives the publishers it advertised
+                Readiness readiness;
                 ros::Publisher collect_event;
                 ros::Publisher collect_status;
                 ros::Publisher collect_energy_status;
                 ros::Subscriber effect;
+
+                uint64_t actuations;
+                double actuation_latency;
+                double max_actuation_latency;
         };
 
     }
@@ -4,6 +4,7 @@
 #include "ros/ros.h"
 
 #include "archlib/AdaptationCommand.h"
+#include "archlib/AdaptationCommandSet.h"
 #include "archlib/ROSComponent.hpp"
 
 namespace arch {
@@ -24,6 +25,8 @@ namespace arch {
                 virtual void tearDown();
 
                 virtual void receiveAdaptationCommand(const archlib::AdaptationCommand::ConstPtr& msg) = 0;
+                // the commands of one control cycle, handed to receiveAdaptationCommand one by one unless overridden
+                virtual void receiveAdaptationCommands(const archlib::AdaptationCommandSet::ConstPtr& msg);
 
             protected:
                 ros::NodeHandle handle;
@@ -0,0 +1,75 @@
+#include "archlib/AdaptationCommands.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace arch {
+
+    void addParameter(archlib::AdaptationCommand &msg, const uint8_t &param, const double &value) {
+        msg.params.push_back(param);
+        msg.values.push_back(value);
+    }
+
+    void merge(archlib::AdaptationCommand &into, const archlib::AdaptationCommand &from) {
+        size_t size = std::min(from.params.size(), from.values.size());
+
+        for (size_t i = 0; i < size; ++i) {
+            std::vector<uint8_t>::iterator it = std::find(into.params.begin(), into.params.end(), from.params[i]);
+
+            if (it != into.params.end()) {
+                into.values[it - into.params.begin()] = from.values[i];
+            } else {
+                addParameter(into, from.params[i], from.values[i]);
+            }
+        }
+
+        into.Header = from.Header;
+        into.source = from.source;
+    }
+
+    std::vector<archlib::AdaptationCommand> coalesce(const archlib::AdaptationCommandSet &set) {
+        std::vector<archlib::AdaptationCommand> commands;
+        std::map<std::string, size_t> index;
+
+        for (const archlib::AdaptationCommand &command : set.commands) {
+            std::map<std::string, size_t>::iterator it = index.find(command.target);
+
+            if (it == index.end()) {
+                it = index.insert(std::make_pair(command.target, commands.size())).first;
+                commands.push_back(archlib::AdaptationCommand());
+                commands.back().target = command.target;
+            }
+
+            merge(commands[it->second], command);
+        }
+
+        return commands;
+    }
+
+    std::string parameterName(const uint8_t &param) {
+        switch (param) {
+            case archlib::AdaptationCommand::FREQ: return "freq";
+            case archlib::AdaptationCommand::REPLICATE_COLLECT: return "replicate_collect";
+            default: return "param" + std::to_string(param);
+        }
+    }
+
+    std::string toString(const archlib::AdaptationCommand &msg) {
+        std::string text;
+        size_t size = std::min(msg.params.size(), msg.values.size());
+
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0) text += ",";
+            text += parameterName(msg.params[i]) + "=";
+            // counts are logged as integers, as they were written before
+            if (msg.params[i] == archlib::AdaptationCommand::REPLICATE_COLLECT) {
+                text += std::to_string(static_cast<int>(msg.values[i]));
+            } else {
+                text += std::to_string(msg.values[i]);
+            }
+        }
+
+        return text;
+    }
+
+}
@@ -0,0 +1,110 @@
+#include "archlib/LoopScheduler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace arch {
+
+    LoopScheduler::LoopScheduler() :
+        freq(1),
+        period(1.0),
+        policy(SKIP),
+        release(),
+        cycles(0),
+        overruns(0),
+        skipped(0),
+        woken(0),
+        jitter(0),
+        max_jitter(0) {}
+
+    void LoopScheduler::setFreq(const double &f) {
+        if (f <= 0 || f == freq) return;
+
+        // the current cycle keeps its release, so its deadline moves right away
+        freq = f;
+        period = ros::Duration(1.0/f);
+    }
+
+    double LoopScheduler::getFreq() const {
+        return freq;
+    }
+
+    void LoopScheduler::setPolicy(const OverrunPolicy &p) {
+        policy = p;
+    }
+
+    LoopScheduler::OverrunPolicy LoopScheduler::parsePolicy(const std::string &p) {
+        if (p == "skip") return SKIP;
+        if (p == "catch_up") return CATCH_UP;
+        throw std::invalid_argument("unknown overrun policy " + p);
+    }
+
+    ros::Time LoopScheduler::deadline() {
+        ros::Time now = ros::Time::now();
+
+        // first cycle, or the clock went back (e.g. a new simulation)
+        if (release.isZero() || now < release) release = now;
+
+        return release + period;
+    }
+
+    bool LoopScheduler::sleep() {
+        ros::Time due = deadline();
+        ros::Time now = ros::Time::now();
+        ++cycles;
+
+        if (now < due) {
+            ros::Time::sleepUntil(due);
+
+            double late = (ros::Time::now() - due).toSec();
+            ++woken;
+            jitter += late;
+            max_jitter = std::max(max_jitter, late);
+
+            release = due;
+            return true;
+        }
+
+        ++overruns;
+        if (policy == SKIP) {
+            // drops the deadlines that went by, the next cycle is released on the
+            // last one and keeps the phase of the loop
+            int64_t missed = (now - due).toNSec() / std::max<int64_t>(period.toNSec(), 1);
+            skipped += missed;
+            release = due + period * static_cast<double>(missed);
+        } else {
+            release = due;
+        }
+        return false;
+    }
+
+    uint64_t LoopScheduler::getCycles() const {
+        return cycles;
+    }
+
+    uint64_t LoopScheduler::getOverruns() const {
+        return overruns;
+    }
+
+    uint64_t LoopScheduler::getSkipped() const {
+        return skipped;
+    }
+
+    double LoopScheduler::meanJitter() const {
+        return woken ? jitter / woken : 0;
+    }
+
+    double LoopScheduler::maxJitter() const {
+        return max_jitter;
+    }
+
+    void LoopScheduler::resetStats() {
+        cycles = 0;
+        overruns = 0;
+        skipped = 0;
+        woken = 0;
+        jitter = 0;
+        max_jitter = 0;
+    }
+
+}
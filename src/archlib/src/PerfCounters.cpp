@@ -0,0 +1,163 @@
+#include "archlib/PerfCounters.hpp"
+
+#include <math.h>
+
+namespace arch {
+
+    namespace {
+        // single writer: a load and a store are enough, no read-modify-write
+        void add(std::atomic<uint64_t> &counter, const uint64_t &value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        double seconds(const uint64_t &ns) {
+            return ns / 1e9;
+        }
+    }
+
+    Histogram::Histogram() : counts(), sum(0) {
+        for (std::atomic<uint64_t> &count : counts) count.store(0, std::memory_order_relaxed);
+    }
+
+    size_t Histogram::bucket(const uint64_t &ns) {
+        if (ns < sub_buckets) return ns;
+
+        // the 3 bits below the leading one pick the sub bucket
+        size_t exponent = 63 - __builtin_clzll(ns);
+        return (exponent - 2) * sub_buckets + ((ns >> (exponent - 3)) & (sub_buckets - 1));
+    }
+
+    uint64_t Histogram::upper(const size_t &b) {
+        if (b < sub_buckets) return b + 1;
+
+        size_t shift = b / sub_buckets - 1;
+        uint64_t mantissa = sub_buckets + b % sub_buckets + 1;
+        // the last bucket goes up to the largest value there is
+        if (mantissa == 2 * sub_buckets && shift >= 60) return UINT64_MAX;
+        return mantissa << shift;
+    }
+
+    uint64_t Histogram::percentile(const std::vector<uint64_t> &counts, const double &q) {
+        uint64_t total = 0;
+        for (uint64_t count : counts) total += count;
+        if (total == 0) return 0;
+
+        uint64_t rank = static_cast<uint64_t>(ceil(q * total));
+        if (rank < 1) rank = 1;
+
+        uint64_t seen = 0;
+        for (size_t b = 0; b < counts.size(); ++b) {
+            seen += counts[b];
+            if (seen >= rank) return upper(b) - 1;
+        }
+        return upper(counts.size() - 1) - 1;
+    }
+
+    void Histogram::record(const uint64_t &ns) {
+        add(counts[bucket(ns)], 1);
+        add(sum, ns);
+    }
+
+    void Histogram::read(std::vector<uint64_t> &out, uint64_t &total) const {
+        out.resize(buckets);
+        for (size_t b = 0; b < buckets; ++b) {
+            out[b] = counts[b].load(std::memory_order_relaxed);
+        }
+        total = sum.load(std::memory_order_relaxed);
+    }
+
+    PerfCounters::PerfCounters() :
+        histograms(),
+        cycles(0),
+        overruns(0),
+        backlogged(0),
+        phase(SPIN),
+        since(),
+        cycle_start(),
+        running(false),
+        last_counts(),
+        last_sum(),
+        last_cycles(0),
+        last_overruns(0),
+        last_backlogged(0) {}
+
+    const char *PerfCounters::name(const Phase &phase) {
+        switch (phase) {
+            case SPIN: return "spin";
+            case BODY: return "body";
+            case SLEEP: return "sleep";
+            default: return "";
+        }
+    }
+
+    void PerfCounters::mark(const Phase &next) {
+        Clock::time_point now = Clock::now();
+
+        if (running) {
+            histograms[phase].record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - since).count());
+        } else {
+            running = true;
+            cycle_start = now;
+        }
+
+        phase = next;
+        since = now;
+    }
+
+    void PerfCounters::backlog(const bool &pending) {
+        if (pending) add(backlogged, 1);
+    }
+
+    void PerfCounters::endCycle(const double &period) {
+        if (!running) return;
+
+        // the cycle was busy until it went to sleep
+        Clock::time_point busy_end = (phase == SLEEP) ? since : Clock::now();
+        mark(phase);
+        running = false;
+
+        add(cycles, 1);
+        if (std::chrono::duration<double>(busy_end - cycle_start).count() > period) add(overruns, 1);
+    }
+
+    void PerfCounters::report(Report &out) {
+        uint64_t value;
+
+        value = cycles.load(std::memory_order_relaxed);
+        out.cycles = value - last_cycles;
+        last_cycles = value;
+
+        value = overruns.load(std::memory_order_relaxed);
+        out.overruns = value - last_overruns;
+        last_overruns = value;
+
+        value = backlogged.load(std::memory_order_relaxed);
+        out.backlogged = value - last_backlogged;
+        last_backlogged = value;
+
+        std::vector<uint64_t> counts;
+        for (size_t p = 0; p < PHASES; ++p) {
+            uint64_t sum;
+            histograms[p].read(counts, sum);
+            last_counts[p].resize(counts.size());
+
+            uint64_t total = 0, highest = 0;
+            for (size_t b = 0; b < counts.size(); ++b) {
+                uint64_t count = counts[b];
+                counts[b] -= last_counts[p][b];
+                last_counts[p][b] = count;
+
+                total += counts[b];
+                if (counts[b] > 0) highest = Histogram::upper(b) - 1;
+            }
+
+            Summary &summary = out.phases[p];
+            summary.mean = total ? seconds(sum - last_sum[p]) / total : 0;
+            summary.p50 = seconds(Histogram::percentile(counts, 0.5));
+            summary.p99 = seconds(Histogram::percentile(counts, 0.99));
+            summary.max = seconds(highest);
+            last_sum[p] = sum;
+        }
+    }
+
+}
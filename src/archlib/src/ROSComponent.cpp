@@ -1,10 +1,18 @@
 #include "archlib/ROSComponent.hpp"
 
+#include <algorithm>
+
 namespace arch {
-	ROSComponent::ROSComponent(int &argc, char **argv, const std::string &name) : rosComponentDescriptor() {
+	ROSComponent::ROSComponent(int &argc, char **argv, const std::string &name) : rosComponentDescriptor(), loop(), tracer(), perf(), wakeup(), diagnostics(), perf_file(), configured(false), perf_period(10), last_report() {
         ros::init(argc, argv, name, ros::init_options::NoSigintHandler); //Configure node name and sets commnd line arguments
         std::string node_name = getRosNodeName(ros::this_node::getName(), ros::this_node::getNamespace());
         rosComponentDescriptor.setName(node_name);
+        tracer.setNode(node_name);
+    }
+
+	ROSComponent::ROSComponent(const std::string &name) : rosComponentDescriptor(), loop(), tracer(), perf(), wakeup(), diagnostics(), perf_file(), configured(false), perf_period(10), last_report() {
+        rosComponentDescriptor.setName((!name.empty() && name[0] == '/') ? name : "/" + name);
+        tracer.setNode(rosComponentDescriptor.getName());
     }
 	ROSComponent::~ROSComponent() {}
 
@@ -12,16 +20,140 @@ namespace arch {
         setUp();
 
         while(ros::ok()) {
-            ros::Rate loop_rate(rosComponentDescriptor.getFreq());
+            perf.mark(PerfCounters::SPIN);
             ros::spinOnce();
+            perf.backlog(!ros::getGlobalCallbackQueue()->isEmpty());
+            perf.mark(PerfCounters::BODY);
             body();
-            loop_rate.sleep();
+            perf.mark(PerfCounters::SLEEP);
+            waitNextCycle();
+            endCycle(loop.getFreq());
         }
 
         tearDown();
         return 0;
     }
 
+    bool ROSComponent::waitForService(const std::string &service) const {
+        double timeout = 30;
+        getParam("startup_timeout", timeout);
+
+        if (ros::service::waitForService(service, ros::Duration(timeout > 0 ? timeout : -1))) return true;
+
+        if (ros::ok()) ROS_WARN("Service %s is not available after %.0lf s", service.c_str(), timeout);
+        return false;
+    }
+
+    void ROSComponent::scheduleWakeup(const ros::Time &deadline) {
+        if (!ros::Time::isSimTime()) return;
+
+        if (!wakeup) {
+            ros::NodeHandle nh;
+            wakeup = nh.advertise<archlib::Wakeup>("/clock_schedule", 100);
+        }
+
+        archlib::Wakeup msg;
+        msg.source = rosComponentDescriptor.getName();
+        msg.Header.stamp = deadline;
+
+        wakeup.publish(msg);
+    }
+
+    void ROSComponent::waitNextCycle() {
+        if (!configured) configure();
+
+        // a reconfiguration during the cycle moves its deadline already
+        loop.setFreq(rosComponentDescriptor.getFreq());
+        scheduleWakeup(loop.deadline());
+        loop.sleep();
+    }
+
+    void ROSComponent::configure() {
+        configured = true;
+        last_report = ros::Time::now();
+
+        std::string policy;
+        if (ros::param::get("overrun_policy", policy)) {
+            try {
+                loop.setPolicy(LoopScheduler::parsePolicy(policy));
+            } catch (const std::invalid_argument &e) {
+                ROS_ERROR("%s, skipping overruns", e.what());
+            }
+        }
+
+        ros::param::get("diagnostics_period", perf_period);
+        if (perf_period > 0) {
+            ros::NodeHandle nh;
+            diagnostics = nh.advertise<archlib::Performance>("diagnostics", 10);
+        }
+
+        std::string dir;
+        if (ros::param::get("diagnostics_dir", dir) && !dir.empty()) {
+            std::string name = rosComponentDescriptor.getName();
+            name.erase(0, name.find_first_not_of('/'));
+            std::replace(name.begin(), name.end(), '/', '_');
+
+            perf_file.open(dir + "/" + name + ".perf", std::fstream::out | std::fstream::trunc);
+            perf_file << "time,cycles,overruns,backlogged,freq,actual_freq,skipped,jitter_mean,jitter_max";
+            for (size_t p = 0; p < PerfCounters::PHASES; ++p) {
+                std::string phase = PerfCounters::name(static_cast<PerfCounters::Phase>(p));
+                perf_file << "," << phase << "_mean," << phase << "_p50," << phase << "_p99," << phase << "_max";
+            }
+            perf_file << std::endl;
+        }
+    }
+
+    void ROSComponent::endCycle(const double &freq) {
+        perf.endCycle(freq > 0 ? 1.0/freq : 0);
+
+        if (!configured) configure();
+
+        ros::Time now = ros::Time::now();
+        if (perf_period > 0 && (now - last_report).toSec() >= perf_period) {
+            reportPerformance(now);
+        }
+    }
+
+    void ROSComponent::reportPerformance(const ros::Time &now) {
+        PerfCounters::Report report;
+        perf.report(report);
+
+        archlib::Performance msg;
+        msg.Header.stamp = now;
+        msg.source = rosComponentDescriptor.getName();
+        msg.cycles = report.cycles;
+        msg.overruns = report.overruns;
+        msg.backlogged = report.backlogged;
+        msg.freq = rosComponentDescriptor.getFreq();
+        msg.actual_freq = report.cycles / (now - last_report).toSec();
+        msg.skipped = loop.getSkipped();
+        msg.jitter_mean = loop.meanJitter();
+        msg.jitter_max = loop.maxJitter();
+        loop.resetStats();
+
+        for (size_t p = 0; p < PerfCounters::PHASES; ++p) {
+            const PerfCounters::Summary &summary = report.phases[p];
+            msg.phases.push_back(PerfCounters::name(static_cast<PerfCounters::Phase>(p)));
+            msg.mean.push_back(summary.mean);
+            msg.p50.push_back(summary.p50);
+            msg.p99.push_back(summary.p99);
+            msg.max.push_back(summary.max);
+        }
+
+        diagnostics.publish(msg);
+
+        if (perf_file.is_open()) {
+            perf_file << now.toNSec() << "," << msg.cycles << "," << msg.overruns << "," << msg.backlogged << "," << msg.freq << "," << msg.actual_freq
+                << "," << msg.skipped << "," << msg.jitter_mean << "," << msg.jitter_max;
+            for (size_t p = 0; p < PerfCounters::PHASES; ++p) {
+                perf_file << "," << msg.mean[p] << "," << msg.p50[p] << "," << msg.p99[p] << "," << msg.max[p];
+            }
+            perf_file << std::endl;
+        }
+
+        last_report = now;
+    }
+
     std::string ROSComponent::getRosNodeName(const std::string& node_name, const std::string& node_namespace) {
         std::string ros_node_name = node_name;
 
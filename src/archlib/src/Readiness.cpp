@@ -0,0 +1,51 @@
+#include "archlib/Readiness.hpp"
+
+#include <algorithm>
+
+namespace arch {
+
+    Readiness::Readiness() : queue(), handle(), publishers() {
+        handle.setCallbackQueue(&queue);
+    }
+
+    Readiness::~Readiness() {}
+
+    void Readiness::connected(const ros::SingleSubscriberPublisher &) {
+        // waking wait() up is all it takes
+    }
+
+    bool Readiness::ready() const {
+        for (const ros::Publisher &pub : publishers) {
+            if (pub.getNumSubscribers() < 1) return false;
+        }
+        return true;
+    }
+
+    bool Readiness::wait(const ros::WallDuration &timeout) {
+        const ros::WallDuration max_backoff(0.1);
+        ros::WallDuration backoff(0.001);
+        ros::WallTime end = ros::WallTime::now() + timeout;
+
+        while (ros::ok()) {
+            if (ready()) return true;
+
+            ros::WallDuration left = end - ros::WallTime::now();
+            if (!timeout.isZero() && left <= ros::WallDuration(0)) return false;
+
+            // blocks until a subscriber connects or the backoff runs out
+            queue.callAvailable((!timeout.isZero() && left < backoff) ? left : backoff);
+            backoff = std::min(backoff * 2, max_backoff);
+        }
+
+        return false;
+    }
+
+    std::vector<std::string> Readiness::pending() const {
+        std::vector<std::string> topics;
+        for (const ros::Publisher &pub : publishers) {
+            if (pub.getNumSubscribers() < 1) topics.push_back(pub.getTopic());
+        }
+        return topics;
+    }
+
+}
@@ -0,0 +1,53 @@
+#include "archlib/Tracer.hpp"
+
+#include <algorithm>
+
+namespace arch {
+
+    Tracer::Tracer() : node(), opened(false), count(0), file() {}
+
+    Tracer::~Tracer() {}
+
+    void Tracer::setNode(const std::string &n) {
+        node = n;
+    }
+
+    // the parameter is only read once ros is up, on first use
+    void Tracer::open() {
+        opened = true;
+
+        std::string dir;
+        if (!ros::param::get("trace_dir", dir) || dir.empty()) return;
+
+        std::string name = node;
+        name.erase(0, name.find_first_not_of('/'));
+        std::replace(name.begin(), name.end(), '/', '_');
+
+        file.open(dir + "/" + name + ".trace", std::fstream::out | std::fstream::trunc);
+        if (!file.is_open()) ROS_ERROR("Could not open the trace file in %s", dir.c_str());
+    }
+
+    bool Tracer::enabled() {
+        if (!opened) open();
+        return file.is_open();
+    }
+
+    void Tracer::start(std_msgs::Header &header, const std::string &hop) {
+        if (!enabled()) return;
+
+        header.frame_id = node + ":" + std::to_string(++count);
+        record(header.frame_id, hop);
+    }
+
+    void Tracer::record(const std_msgs::Header &header, const std::string &hop) {
+        record(header.frame_id, hop);
+    }
+
+    void Tracer::record(const std::string &trace, const std::string &hop) {
+        if (trace.empty() || !enabled()) return;
+
+        // most nodes are stopped by a SIGINT they do not handle, nothing may be left in the buffer
+        file << trace << "," << hop << "," << node << "," << ros::Time::now().toNSec() << std::endl;
+    }
+
+}
@@ -2,7 +2,11 @@
 
 namespace arch {
 	namespace target_system {
-		Component::Component(int &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name) {}
+		volatile sig_atomic_t Component::interrupted = 0;
+
+		Component::Component(int &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), readiness(), actuations(0), actuation_latency(0), max_actuation_latency(0) {}
+
+		Component::Component(const std::string &name) : ROSComponent(name), readiness(), actuations(0), actuation_latency(0), max_actuation_latency(0) {}
 
 		Component::~Component() {}
 
@@ -12,14 +16,18 @@ namespace arch {
 			ROS_INFO("Module initial frequency: %lf", freq);
 			rosComponentDescriptor.setFreq(freq);
 
-			collect_event = handle.advertise<archlib::Event>("collect_event", 10);
-			while(collect_event.getNumSubscribers() < 1) {} // to cope with the delay on opening the connection
-
-			collect_status = handle.advertise<archlib::Status>("collect_status", 10);
-			while(collect_status.getNumSubscribers() < 1) {}
-
-			collect_energy_status = handle.advertise<archlib::EnergyStatus>("collect_energy_status", 10);
-			while(collect_energy_status.getNumSubscribers() < 1) {}
+			collect_event = readiness.advertise<archlib::Event>("collect_event", 10);
+			collect_status = readiness.advertise<archlib::Status>("collect_status", 10);
+			collect_energy_status = readiness.advertise<archlib::EnergyStatus>("collect_energy_status", 10);
+
+			// to cope with the delay on opening the connections, the probe might not be up yet
+			double timeout = 30;
+			getParam("startup_timeout", timeout);
+			if (!readiness.wait(ros::WallDuration(timeout))) {
+				for (const std::string &topic : readiness.pending()) {
+					ROS_WARN("No subscriber to %s after %.0lf s, the first messages may be lost", topic.c_str(), timeout);
+				}
+			}
 
 			sendStatus("init");
 			activate();
@@ -31,10 +39,11 @@ namespace arch {
             ros::ServiceClient client_module;
 
 			client_module = client_handler.serviceClient<archlib::EffectorRegister>("EffectorRegister");
+			waitForService("EffectorRegister");
 
 			archlib::EffectorRegister srv;
 
-			srv.request.name = getRosNodeName(ros::this_node::getName(), ros::this_node::getNamespace());
+			srv.request.name = rosComponentDescriptor.getName();
 			srv.request.connection = true;
 
 			if(client_module.call(srv)) {
@@ -52,33 +61,39 @@ namespace arch {
 			*/
 		}
 
+		/*
+		 * Only flags the interruption, every component then leaves its loop and
+		 * detaches itself from its own thread, where it can call the effector
+		 */
 		void Component::sigIntHandler(int signal) {
-			shutdownComponent();
+			interrupted = 1;
+		}
+
+		bool Component::running() const {
+			return ros::ok() && !interrupted;
 		}
 
-		void Component::shutdownComponent() {
+		/*
+		 * Deactivates this component and unregisters it from the effector,
+		 * without bringing down the process it is hosted in
+		 */
+		void Component::detach() {
 			archlib::Event eventMsg;
 			archlib::Status statusMsg;
 
-			eventMsg.source = getRosNodeName(ros::this_node::getName(), ros::this_node::getNamespace());
+			eventMsg.source = rosComponentDescriptor.getName();
 			eventMsg.content = "deactivate";
 
-			statusMsg.source = getRosNodeName(ros::this_node::getName(), ros::this_node::getNamespace());
+			statusMsg.source = rosComponentDescriptor.getName();
 			statusMsg.content = "status";
 
-			ros::NodeHandle nh;
-
-			ros::Publisher last_event = nh.advertise<archlib::Event>("collect_event", 10);
-			while(last_event.getNumSubscribers() < 1) {} // to cope with the delay on opening the connection
-			last_event.publish(eventMsg);
-
-			ros::Publisher last_status = nh.advertise<archlib::Status>("collect_status", 10);
-			while(last_status.getNumSubscribers() < 1) {}
-			last_status.publish(statusMsg);
+			if (collect_event) collect_event.publish(eventMsg);
+			if (collect_status) collect_status.publish(statusMsg);
+			status = false;
 
 			// Unregister from effector
 			archlib::EffectorRegister srv;
-			srv.request.name = getRosNodeName(ros::this_node::getName(), ros::this_node::getNamespace());
+			srv.request.name = rosComponentDescriptor.getName();
 			srv.request.connection = false;
 
 			ros::NodeHandle client_handler;
@@ -86,23 +101,24 @@ namespace arch {
 
 			//Connection to scheduler module management service
 			client_module = client_handler.serviceClient<archlib::EffectorRegister>("EffectorRegister");
+			waitForService("EffectorRegister");
 
 			if(client_module.call(srv)) {
 				ROS_INFO("Succesfully disconnected from effector.");
 			} else {
 				ROS_ERROR("Failed to disconnect from effector.");
 			}
-		
-			ros::shutdown();
 		}
 
 		int32_t Component::run() {
 			setUp();
 
-			while(ros::ok()) {
-				ros::Rate loop_rate(rosComponentDescriptor.getFreq());
+			while(running()) {
+				perf.mark(PerfCounters::SPIN);
 				ros::spinOnce();
+				perf.backlog(!ros::getGlobalCallbackQueue()->isEmpty());
 
+				perf.mark(PerfCounters::BODY);
 				sendStatus("running");
 				try{
 					body();
@@ -110,16 +126,20 @@ namespace arch {
 				} catch (const std::exception& e) {
 					sendStatus("fail");
 				} 
-				loop_rate.sleep();
+				perf.mark(PerfCounters::SLEEP);
+				waitNextCycle();
+				endCycle(loop.getFreq());
 			}
 			
 			tearDown();
+			if (interrupted) detach();
 			return 0;
 		}
 
 		void Component::sendEvent(const std::string &content) {
 			archlib::Event msg;
 
+			msg.Header.stamp = ros::Time::now();
 			msg.source = rosComponentDescriptor.getName();
 			msg.content = content;
 			msg.freq = rosComponentDescriptor.getFreq();
@@ -130,8 +150,10 @@ namespace arch {
 		void Component::sendStatus(const std::string &content) {
 			archlib::Status msg;
 
+			msg.Header.stamp = ros::Time::now();
 			msg.source = rosComponentDescriptor.getName();
 			msg.content = content;
+			tracer.start(msg.Header, "status");
 
 			collect_status.publish(msg);
 		}
@@ -149,6 +171,24 @@ namespace arch {
 			reconfigure(msg);
 		}
 
+		/*
+		 * Time from the controller deciding a reconfiguration to this
+		 * component applying it, summarized every 10 reconfigurations
+		 */
+		void Component::recordActuation(const std_msgs::Header &header) {
+			tracer.record(header, "reconfigure");
+			if (header.stamp.isZero()) return;
+
+			double latency = (ros::Time::now() - header.stamp).toSec();
+			actuation_latency += latency;
+			max_actuation_latency = std::max(max_actuation_latency, latency);
+
+			if (++actuations % 10 == 0) {
+				ROS_INFO("Actuation latency: mean %.3lf ms, max %.3lf ms over %lu reconfigurations",
+					1000 * actuation_latency / actuations, 1000 * max_actuation_latency, static_cast<unsigned long>(actuations));
+			}
+		}
+
 		void Component::activate() {
 			sendEvent("activate");
 			status = true;
@@ -8,10 +8,16 @@ namespace arch {
 
         void Effector::setUp() {
 			double freq;
-			handle.getParam("frequency", freq);
+			getParam("frequency", freq);
 			rosComponentDescriptor.setFreq(freq);
 		}
 		
         void Effector::tearDown() {}
+
+        void Effector::receiveAdaptationCommands(const archlib::AdaptationCommandSet::ConstPtr& msg) {
+			for (const archlib::AdaptationCommand &command : msg->commands) {
+				receiveAdaptationCommand(archlib::AdaptationCommand::ConstPtr(new archlib::AdaptationCommand(command)));
+			}
+		}
 	}
 }
\ No newline at end of file
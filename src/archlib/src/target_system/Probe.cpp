@@ -7,12 +7,17 @@ namespace arch {
 		Probe::~Probe() {}
 
         void Probe::setUp() {
-            log_event = handle.advertise<archlib::Event>("log_event", 1000);
-            log_status = handle.advertise<archlib::Status>("log_status", 1000);
+            // with direct_control events and statuses go straight to their
+            // consumers and the logger only taps them, otherwise it relays them
+            bool direct_control = false;
+            handle.getParam("direct_control", direct_control);
+
+            log_event = handle.advertise<archlib::Event>(direct_control ? "event" : "log_event", 1000);
+            log_status = handle.advertise<archlib::Status>(direct_control ? "status" : "log_status", 1000);
             log_energy_status = handle.advertise<archlib::EnergyStatus>("log_energy_status", 1000);
 
             double freq;
-	        handle.getParam("frequency", freq);
+	        getParam("frequency", freq);
 	        rosComponentDescriptor.setFreq(freq);
         }
 
@@ -26,6 +31,7 @@ namespace arch {
 
         void Probe::collectStatus(const archlib::Status::ConstPtr& msg) {
             //ROS_INFO("I heard: [%s: %s]", msg->source.c_str(), msg->content.c_str());
+            tracer.record(msg->Header, "probe");
             log_status.publish(msg);
         }
 
@@ -0,0 +1,50 @@
+#include "libbsn/analysis/LogAnalyzer.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+/*
+ * log_analyzer <logID> <metric> <setpoint> [log dir] [models dir]
+ *
+ * prints what simulation/analyzer/analyzer.py prints for the same execution,
+ * without the plots; log dir and models dir default to the knowledge
+ * repository, as seen from simulation/analyzer
+ */
+int32_t main(int argc, char **argv) {
+    if (argc < 4) {
+        std::cerr << "usage: " << argv[0] << " <logID> <reliability|cost> <setpoint> [log dir] [models dir]" << std::endl;
+        return 1;
+    }
+
+    std::string id = argv[1];
+    std::string metric = argv[2];
+    std::string log_dir = argc > 4 ? argv[4] : "../../knowledge_repository/resource/logs";
+    std::string models_dir = argc > 5 ? argv[5] : "../../knowledge_repository/resource/models";
+
+    try {
+        double setpoint = std::stod(argv[3]);
+
+        std::string formula;
+        std::ifstream file(models_dir + "/" + metric + ".formula");
+        if (!std::getline(file, formula)) throw std::invalid_argument("could not read formula " + models_dir + "/" + metric + ".formula");
+
+        bsn::analysis::LogAnalyzer analyzer(formula, metric, setpoint);
+        analyzer.read(log_dir, id);
+        bsn::analysis::ControlMetrics metrics = analyzer.analyze();
+
+        std::printf("-----------------------------------------------\n");
+        std::printf("Converge to: %.2f\n", metrics.mean);
+        std::printf("Stability: %s\n", metrics.stable ? "True" : "False");
+        std::printf("Settling Time: %.2fs\n", metrics.settling_time);
+        std::printf("Overshoot: %.2f%%\n", metrics.overshoot);
+        std::printf("Steady-State Error: %.2f%%\n", metrics.sse);
+        std::printf("Robustness: %.2f%%\n", metrics.robustness);
+        std::printf("-----------------------------------------------\n");
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <vector>
+
+#include "libbsn/configuration/SensorConfiguration.hpp"
+#include "libbsn/range/Range.hpp"
+
+using namespace bsn::range;
+using namespace bsn::configuration;
+
+namespace {
+    // thermometer configuration of the BSN
+    SensorConfiguration thermometer() {
+        std::array<Range, 2> midRanges = {{Range(33, 35), Range(37.6, 39.0)}};
+        std::array<Range, 2> highRanges = {{Range(20, 32), Range(39.1, 43.0)}};
+        std::array<Range, 3> percentages = {{Range(0, 20), Range(21, 65), Range(66, 100)}};
+
+        return SensorConfiguration(0, Range(36.5, 37.5), midRanges, highRanges, percentages);
+    }
+}
+
+static void BM_SensorConfigurationEvaluateNumber(benchmark::State &state) {
+    SensorConfiguration config = thermometer();
+    // sweeps all the risk ranges
+    double value = 20;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config.evaluateNumber(value));
+        value = (value >= 43) ? 20 : value + 0.1;
+    }
+}
+BENCHMARK(BM_SensorConfigurationEvaluateNumber);
+
+static void BM_SensorConfigurationEvaluateNumbers(benchmark::State &state) {
+    SensorConfiguration config = thermometer();
+    std::vector<double> values(state.range(0)), risks(state.range(0));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 20 + 23.0 * i / values.size();
+    }
+
+    for (auto _ : state) {
+        config.evaluateNumbers(values.data(), risks.data(), values.size());
+        benchmark::DoNotOptimize(risks.data());
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_SensorConfigurationEvaluateNumbers)->Arg(64)->Arg(4096);
+
+static void BM_SensorConfigurationLabel(benchmark::State &state) {
+    SensorConfiguration config = thermometer();
+    double value = 20;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config.label(value));
+        value = (value >= 43) ? 20 : value + 0.1;
+    }
+}
+BENCHMARK(BM_SensorConfigurationLabel);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include "libbsn/filters/MovingAverage.hpp"
+#include "libbsn/filters/ExponentialMovingAverage.hpp"
+#include "libbsn/filters/MovingMedian.hpp"
+
+static void BM_MovingAverageInsert(benchmark::State &state) {
+    bsn::filters::MovingAverage filter(state.range(0));
+    double value = 0;
+
+    for (auto _ : state) {
+        filter.insert(value);
+        value += 1;
+    }
+}
+BENCHMARK(BM_MovingAverageInsert)->RangeMultiplier(4)->Range(1, 256);
+
+// what a sensor does every cycle
+static void BM_MovingAverageInsertGetValue(benchmark::State &state) {
+    bsn::filters::MovingAverage filter(state.range(0));
+    double value = 0;
+
+    for (auto _ : state) {
+        filter.insert(value);
+        benchmark::DoNotOptimize(filter.getValue());
+        value += 1;
+    }
+}
+BENCHMARK(BM_MovingAverageInsertGetValue)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_ExponentialMovingAverageInsertGetValue(benchmark::State &state) {
+    bsn::filters::ExponentialMovingAverage filter(state.range(0));
+    double value = 0;
+
+    for (auto _ : state) {
+        filter.insert(value);
+        benchmark::DoNotOptimize(filter.getValue());
+        value += 1;
+    }
+}
+BENCHMARK(BM_ExponentialMovingAverageInsertGetValue)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_MovingMedianInsertGetValue(benchmark::State &state) {
+    bsn::filters::MovingMedian filter(state.range(0));
+    double value = 0;
+
+    for (auto _ : state) {
+        filter.insert(value);
+        benchmark::DoNotOptimize(filter.getValue());
+        value = (value > 100) ? 0 : value + 37;
+    }
+}
+BENCHMARK(BM_MovingMedianInsertGetValue)->RangeMultiplier(4)->Range(1, 256);
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "libbsn/generator/DataGenerator.hpp"
+#include "libbsn/generator/Markov.hpp"
+#include "libbsn/generator/NoiseGenerator.hpp"
+#include "libbsn/range/Range.hpp"
+
+using namespace bsn::range;
+using namespace bsn::generator;
+
+namespace {
+    // heart rate chain of the patient
+    DataGenerator heartRate() {
+        std::vector<double> transitions = {72,21,4,2,1, 14,61,19,4,2, 1,17,60,20,2, 0,2,15,70,13, 0,1,2,20,77};
+        std::vector<Range> ranges = {Range(0, 70), Range(70, 85), Range(85, 97), Range(97, 115), Range(115, 300)};
+
+        DataGenerator generator(Markov(transitions, ranges, 2));
+        generator.setSeed();
+        return generator;
+    }
+}
+
+static void BM_DataGeneratorNextState(benchmark::State &state) {
+    DataGenerator generator = heartRate();
+
+    for (auto _ : state) {
+        generator.nextState();
+    }
+}
+BENCHMARK(BM_DataGeneratorNextState);
+
+static void BM_DataGeneratorGetValue(benchmark::State &state) {
+    DataGenerator generator = heartRate();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.getValue());
+    }
+}
+BENCHMARK(BM_DataGeneratorGetValue);
+
+// n samples per state change, as the patient does between two transitions
+static void BM_DataGeneratorSamples(benchmark::State &state) {
+    DataGenerator generator = heartRate();
+
+    for (auto _ : state) {
+        generator.nextState();
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            benchmark::DoNotOptimize(generator.getValue());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DataGeneratorSamples)->RangeMultiplier(10)->Range(1, 1000);
+
+// the same trace as BM_DataGeneratorSamples, drawn in bulk
+static void BM_DataGeneratorGenerate(benchmark::State &state) {
+    DataGenerator generator = heartRate();
+    std::vector<double> values(4096);
+
+    for (auto _ : state) {
+        generator.generate(values.size(), values.data(), state.range(0));
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_DataGeneratorGenerate)->RangeMultiplier(10)->Range(1, 1000);
+
+// a sensor cycle with replicate_collect replicas of the collected value
+static void BM_NoiseGeneratorReplicate(benchmark::State &state) {
+    NoiseGenerator noise(1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(noise.replicate(36.5, 0.1, state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NoiseGeneratorReplicate)->Arg(1)->Arg(10)->Arg(200);
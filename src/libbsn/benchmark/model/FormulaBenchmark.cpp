@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <string>
+
+#include "libbsn/model/Formula.hpp"
+#include "lepton/Lepton.h"
+
+namespace {
+    // product of n reliability terms, shaped as the reliability formula of the BSN
+    std::string product(const int64_t &n) {
+        std::string text = "R_0";
+        for (int64_t i = 1; i < n; ++i) text += "*R_" + std::to_string(i);
+        return text;
+    }
+
+    std::map<std::string, double> values(const int64_t &n) {
+        std::map<std::string, double> tvmap;
+        for (int64_t i = 0; i < n; ++i) tvmap["R_" + std::to_string(i)] = 0.99;
+        return tvmap;
+    }
+}
+
+static void BM_FormulaEvaluate(benchmark::State &state) {
+    bsn::model::Formula formula(product(state.range(0)));
+    formula.setTermValueMap(values(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(formula.evaluate());
+    }
+}
+BENCHMARK(BM_FormulaEvaluate)->RangeMultiplier(4)->Range(2, 128);
+
+// as the engines do: a new term-value map for every evaluation
+static void BM_FormulaSetAndEvaluate(benchmark::State &state) {
+    bsn::model::Formula formula(product(state.range(0)));
+    std::map<std::string, double> tvmap = values(state.range(0));
+
+    for (auto _ : state) {
+        formula.setTermValueMap(tvmap);
+        benchmark::DoNotOptimize(formula.evaluate());
+    }
+}
+BENCHMARK(BM_FormulaSetAndEvaluate)->RangeMultiplier(4)->Range(2, 128);
+
+static void BM_LeptonParse(benchmark::State &state) {
+    std::string text = product(state.range(0));
+
+    for (auto _ : state) {
+        Lepton::ParsedExpression expression = Lepton::Parser::parse(text);
+        benchmark::DoNotOptimize(&expression);
+    }
+}
+BENCHMARK(BM_LeptonParse)->RangeMultiplier(4)->Range(2, 128);
+
+static void BM_LeptonCreateCompiledExpression(benchmark::State &state) {
+    Lepton::ParsedExpression expression = Lepton::Parser::parse(product(state.range(0)));
+
+    for (auto _ : state) {
+        Lepton::CompiledExpression compiled = expression.createCompiledExpression();
+        benchmark::DoNotOptimize(&compiled);
+    }
+}
+BENCHMARK(BM_LeptonCreateCompiledExpression)->RangeMultiplier(4)->Range(2, 128);
@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <vector>
+
+#include "libbsn/processor/Processor.hpp"
+
+static void BM_DataFuse(benchmark::State &state) {
+    std::vector<double> risks;
+    for (int64_t i = 0; i < state.range(0); ++i) risks.push_back((i * 37) % 100);
+
+    // data_fuse reports every fusion on stdout, measure the fusion only
+    std::cout.setstate(std::ios_base::failbit);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bsn::processor::data_fuse(risks));
+    }
+    std::cout.clear();
+}
+BENCHMARK(BM_DataFuse)->Arg(6)->Arg(60)->Arg(600);
+
+static void BM_GetSensorId(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bsn::processor::get_sensor_id("glucosemeter"));
+    }
+}
+BENCHMARK(BM_GetSensorId);
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "libbsn/random/Philox.hpp"
+#include "libbsn/random/Xoshiro256.hpp"
+
+static void BM_PhiloxUniform(benchmark::State &state) {
+    bsn::random::Philox rng(1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rng.uniform());
+    }
+}
+BENCHMARK(BM_PhiloxUniform);
+
+static void BM_PhiloxFill(benchmark::State &state) {
+    bsn::random::Philox rng(1);
+    std::vector<double> out(state.range(0));
+
+    for (auto _ : state) {
+        rng.fill(out.data(), out.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PhiloxFill)->RangeMultiplier(16)->Range(16, 4096);
+
+static void BM_Xoshiro256Fill(benchmark::State &state) {
+    bsn::random::Xoshiro256 rng(1);
+    std::vector<double> out(state.range(0));
+
+    for (auto _ : state) {
+        rng.fill(out.data(), out.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Xoshiro256Fill)->RangeMultiplier(16)->Range(16, 4096);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "libbsn/utils/utils.hpp"
+
+// "/g3t1_1:success,fail,...", as the knowledge repository answers the engines
+static void BM_Split(benchmark::State &state) {
+    std::string text = "/g3t1_1:";
+    for (int64_t i = 0; i < state.range(0); ++i) text += (i % 2) ? "fail," : "success,";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bsn::utils::split(text, ','));
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Split)->RangeMultiplier(8)->Range(1, 4096);
+
+// the same text walked with the lazy tokenizer
+static void BM_Tokenizer(benchmark::State &state) {
+    std::string text = "/g3t1_1:";
+    for (int64_t i = 0; i < state.range(0); ++i) text += (i % 2) ? "fail," : "success,";
+
+    for (auto _ : state) {
+        size_t count = 0;
+        for (bsn::utils::StringView token : bsn::utils::Tokenizer(text, ',')) {
+            count += token.size();
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_Tokenizer)->RangeMultiplier(8)->Range(1, 4096);
+
+static void BM_Stod(benchmark::State &state) {
+    std::string text = "/g3t1_1:0.912345";
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::stod(bsn::utils::split(text, ':')[1]));
+    }
+}
+BENCHMARK(BM_Stod);
+
+static void BM_ToDouble(benchmark::State &state) {
+    std::string text = "/g3t1_1:0.912345";
+
+    for (auto _ : state) {
+        bsn::utils::StringView component, value;
+        bsn::utils::split_once(text, ':', component, value);
+        benchmark::DoNotOptimize(bsn::utils::to_double(value));
+    }
+}
+BENCHMARK(BM_ToDouble);
@@ -0,0 +1,57 @@
+#ifndef HISTORY_HPP
+#define HISTORY_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "libbsn/storage/TimeIndex.hpp"
+
+namespace bsn {
+    namespace analysis {
+
+        /*
+         * Time-range queries over the logs of an execution, as the knowledge
+         * repository (DataAccess) persists them, for horizons longer than it
+         * keeps in memory. Plain logs are read through a TimeIndex kept next
+         * to them (<log>_<id>.tix) and segmented ones through their .idx, so
+         * only the blocks in range are read. The indexes are brought up to
+         * date on every query, the logs may still be being written.
+         *
+         * Results are one value per bucket of bucket ns, the first starting
+         * at from, the last ending at or after to, by component as it is
+         * logged; NaN where the component logged nothing.
+         */
+        class History {
+
+            public:
+                // <dir>/<log>_<id>.log, plain or in segments
+                History(const std::string &dir, const std::string &id);
+                ~History();
+
+            private:
+                History(const History &);
+                History &operator=(const History &);
+
+            public:
+                // share of successes among the statuses of a component (e.g. /g3t1_3),
+                // or of every component if it is empty, with timestamps in [from, to)
+                std::map<std::string, std::vector<double>> reliability(const std::string &component, const int64_t &from, const int64_t &to, const int64_t &bucket);
+                // mean of the costs the engine reported for a component (e.g. g3t1_3, or
+                // global for the whole system), or for every one if it is empty
+                std::map<std::string, std::vector<double>> cost(const std::string &component, const int64_t &from, const int64_t &to, const int64_t &bucket);
+
+            private:
+                std::map<std::string, std::vector<double>> aggregate(const std::string &log, const std::string &component,
+                                                                     const int64_t &from, const int64_t &to, const int64_t &bucket);
+
+                std::string dir;
+                std::string id;
+                std::map<std::string, std::shared_ptr<bsn::storage::TimeIndex>> indexes;
+        };
+    }
+}
+
+#endif
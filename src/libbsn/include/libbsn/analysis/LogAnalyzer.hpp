@@ -0,0 +1,113 @@
+#ifndef LOGANALYZER_HPP
+#define LOGANALYZER_HPP
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+#include "libbsn/model/Formula.hpp"
+#include "libbsn/utils/StringView.hpp"
+
+namespace bsn {
+    namespace analysis {
+
+        // how well the adaptation manager held the QoS attribute at its setpoint
+        struct ControlMetrics {
+            double mean;          // value the curve converges to
+            bool stable;
+            double settling_time; // s
+            double overshoot;     // %
+            double sse;           // steady-state error, %
+            double robustness;    // %
+        };
+
+        /*
+         * Computes the QoS curve of an execution from the logs of the
+         * knowledge repository (DataAccess), and how well it was controlled
+         * from the first adaptation on, with the same numbers as
+         * simulation/analyzer/src/Analyzer.py.
+         *
+         * The logs are streamed in logical order, once. The reliability of a
+         * component is the share of successes among its statuses of the last
+         * 25 s, kept over a sliding window, and the global one is the formula
+         * evaluated with them after every status and event. The cost curve
+         * is the global cost reported by the engine.
+         */
+        class LogAnalyzer {
+
+            public:
+                // metric is reliability or cost, throws std::invalid_argument otherwise
+                LogAnalyzer(const std::string &formula, const std::string &metric, const double &setpoint);
+                ~LogAnalyzer();
+
+            private:
+                LogAnalyzer(const LogAnalyzer &);
+                LogAnalyzer &operator=(const LogAnalyzer &);
+
+            public:
+                // <dir>/<log>_<id>.log, the logs of one execution, plain or in segments;
+                // throws std::runtime_error if one is missing or out of logical order
+                void read(const std::string &dir, const std::string &id);
+
+                // a component deactivated during the execution (e.g. /g3t1_1) does not
+                // count in the formula, it must be known before the registers are added
+                void deactivate(const std::string &source);
+                // a line of the status or energy status, event or adaptation log, in
+                // logical order: name,logical clock,timestamp (ns),source,target,content
+                void add(const bsn::utils::StringView &line);
+
+                // (ns since the first register, value)
+                const std::vector<std::pair<int64_t, double>> &getCurve() const;
+                // throws std::runtime_error if there is nothing after the first adaptation
+                ControlMetrics analyze() const;
+
+            private:
+                // the statuses of a component over the last window ns
+                struct Task {
+                    std::vector<std::pair<int64_t, int>> invocations;
+                    size_t first;
+                    int64_t successes;
+                    bool ordered;
+                    double reliability;
+                    double *reliability_term;
+                    double *frequency_term;
+                };
+
+                static std::string tag(const bsn::utils::StringView &name);
+                double *term(const std::string &name);
+
+                void status(const int64_t &instant, const bsn::utils::StringView &source, const bsn::utils::StringView &content);
+                void event(const bsn::utils::StringView &source, const bsn::utils::StringView &content);
+                void point(const int64_t &instant, const double &value);
+                double evaluate();
+
+                static const int64_t window;
+                static const double stability_margin;
+
+                Lepton::CompiledExpression expression;
+                bool reliability;
+                double setpoint;
+
+                std::map<std::string, Task> tasks;
+                std::vector<Task *> task_order;
+                // components that sent an event, active unless they said otherwise
+                std::set<std::string> contexts;
+                std::set<std::string> deactivated;
+                // terms left out of the formula, and the value they are held at
+                std::vector<std::pair<double *, double>> ignored;
+
+                bool started;
+                int64_t t0;
+                int64_t triggered;
+                std::set<std::string> adapted;
+
+                std::vector<std::pair<int64_t, double>> curve;
+                std::map<int64_t, size_t> curve_index;
+        };
+    }
+}
+
+#endif
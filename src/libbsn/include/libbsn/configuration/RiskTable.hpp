@@ -0,0 +1,62 @@
+#ifndef RISKTABLE_HPP
+#define RISKTABLE_HPP
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "libbsn/range/Range.hpp"
+
+namespace bsn {
+	namespace configuration {
+
+		/*
+		 * Compiled form of the risk ranges of a SensorConfiguration.
+		 *
+		 * The sorted bounds of the ranges split the line into cells (every
+		 * bound on its own and the open intervals between them). Each cell
+		 * keeps the level of the range that wins there, in the precedence
+		 * order of SensorConfiguration::evaluateNumber, and the map of that
+		 * range into percentage space:
+		 *     risk = |value - origin| / span * width + lower
+		 * A value is located by counting the bounds below it, which takes a
+		 * fixed number of compares and no branches.
+		 */
+		class RiskTable {
+			public:
+				enum Level { LOW, MEDIUM, HIGH, UNKNOWN };
+
+				RiskTable();
+				RiskTable(const bsn::range::Range &low,
+							const std::array<bsn::range::Range, 2> &medium,
+							const std::array<bsn::range::Range, 2> &high,
+							const std::array<bsn::range::Range, 3> &percentages);
+
+				RiskTable(const RiskTable & /*obj*/);
+				RiskTable &operator=(const RiskTable & /*obj*/);
+
+				Level classify(const double &value) const;
+				// -1 if value is in none of the ranges
+				double evaluate(const double &value) const;
+				void evaluate(const double *values, double *risks, const size_t &n) const;
+
+			private:
+				static const size_t max_bounds = 10;
+				// every bound and the interval before it, the interval after the last and an unused one
+				static const size_t max_cells = 2 * max_bounds + 2;
+
+				size_t locate(const double &value) const;
+
+				// sorted, padded with +inf
+				std::array<double, max_bounds + 1> bounds;
+				std::array<int32_t, max_cells> levels;
+				std::array<double, max_cells> origin;
+				std::array<double, max_cells> span;
+				std::array<double, max_cells> width;
+				std::array<double, max_cells> lower;
+		};
+
+	}
+}
+
+#endif
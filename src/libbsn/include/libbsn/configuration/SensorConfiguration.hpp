@@ -8,6 +8,7 @@
 #include <sstream>
 
 #include "libbsn/range/Range.hpp"
+#include "libbsn/configuration/RiskTable.hpp"
 
 namespace bsn {
 	namespace configuration {
@@ -31,11 +32,21 @@ namespace bsn {
 				std::array<bsn::range::Range, 2> mediumRisk;
 				std::array<bsn::range::Range, 2> highRisk;
 				bsn::range::Range lowPercentage, midPercentage, highPercentage;
+				// the ranges above compiled for lookups, rebuilt by every setter
+				RiskTable table;
+
+				void compile();
 
 			public:
 
 				// Retorna o estado de risco a partir dos intervalos
-				double evaluateNumber(double number);
+				double evaluateNumber(double number) const;
+
+				// evaluateNumber of n values at once
+				void evaluateNumbers(const double *numbers, double *risks, const size_t &n) const;
+
+				// "low", "moderate", "high" or "unknown", after the range val is in
+				std::string label(double val) const;
 
 				// Retorna o quão deslocado do meio um valor está
 				double getDisplacement(bsn::range::Range, double, std::string );
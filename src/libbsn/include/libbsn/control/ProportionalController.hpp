@@ -0,0 +1,48 @@
+#ifndef PROPORTIONALCONTROLLER_HPP
+#define PROPORTIONALCONTROLLER_HPP
+
+namespace bsn {
+    namespace control {
+
+        // what the enactor should send to a component after a step
+        struct ControlAction {
+            enum Command { NONE, FREQ, REPLICATE_COLLECT };
+
+            ControlAction() : command(NONE), value(0), exception(0) {}
+
+            Command command;
+            double value;		// the new frequency, or number of replicas to collect
+            int exception;		// 1 or -1 to raise or lower the priority of the component at the engine, 0 otherwise
+        };
+
+        /*
+         * Proportional control of the enactor, of the frequency of a
+         * component (or of how many replicas of each sample it collects)
+         * towards the reference the engine planned for it. The frequency of
+         * the sensors is kept within [min_freq, max_freq], that of the
+         * central hub only positive. A component that keeps missing its
+         * reference (or meeting it) for more than 4 steps in a row is
+         * reported to the engine, which changes its priority.
+         */
+        class ProportionalController {
+
+            public:
+                ProportionalController(const double &min_freq, const double &max_freq, const double &stability_margin);
+                ~ProportionalController();
+
+                ProportionalController(const ProportionalController &);
+                ProportionalController &operator=(const ProportionalController &);
+
+                // freq, replicate and exception_buffer are the state of the component, updated by the step
+                ControlAction step(const bool &hub, const bool &replicate_collect, const double &ref, const double &curr, const double &kp,
+                                   double &freq, int &replicate, int &exception_buffer) const;
+
+            private:
+                double min_freq;
+                double max_freq;
+                double stability_margin;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef RELIABILITYPLANNER_HPP
+#define RELIABILITYPLANNER_HPP
+
+#include <map>
+#include <string>
+
+#include "libbsn/model/Formula.hpp"
+
+namespace bsn {
+    namespace control {
+
+        /*
+         * Analysis and planning of the reliability engine. A strategy maps
+         * the terms of the reliability formula (R_G3_T1_1, CTX_G3_T1_1,
+         * F_G3_T1_1, ...) to their values. When the reliability of the
+         * system is off the setpoint, plan searches for the reliabilities
+         * the components should reach to bring it back: starting from the
+         * current one, moved by offset away from the setpoint, it steps the
+         * reliability of each component in turn by gain times the error,
+         * for as long as the system gets closer to the setpoint, the
+         * components with the lowest priority first.
+         */
+        class ReliabilityPlanner {
+
+            public:
+                ReliabilityPlanner(const double &setpoint, const double &offset, const double &gain, const double &tolerance = 0.02);
+                ~ReliabilityPlanner();
+
+                ReliabilityPlanner(const ReliabilityPlanner &);
+                ReliabilityPlanner &operator=(const ReliabilityPlanner &);
+
+                // whether the reliability of the system is further from the setpoint than the tolerance
+                bool off(const double &reliability) const;
+
+                // whether the search converged, strategy then holds the reliabilities to reach,
+                // deactivated components (deactivated[term] != 0) are left at 1
+                bool plan(bsn::model::Formula model, std::map<std::string, double> &strategy,
+                          const std::map<std::string, int> &priority, const std::map<std::string, int> &deactivated) const;
+
+            private:
+                double setpoint;
+                double offset;
+                double gain;
+                double tolerance;
+        };
+
+        // raises (change > 0) or lowers the priority of a term, within [0, 100],
+        // as asked by the enactor, returns false if the term has no priority
+        bool prioritize(std::map<std::string, int> &priority, const std::string &term, const int &change);
+    }
+}
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef STATUSWINDOW_HPP
+#define STATUSWINDOW_HPP
+
+#include <deque>
+#include <string>
+#include <utility>
+
+namespace bsn {
+    namespace control {
+
+        /*
+         * Statuses a component sent over the last span seconds, as the
+         * knowledge repository keeps them to compute its reliability: the
+         * share of successes among its successes and failures. Statuses are
+         * pushed as they arrive, hence in order of time.
+         */
+        class StatusWindow {
+
+            public:
+                explicit StatusWindow(const double &span = 10.1);
+                ~StatusWindow();
+
+                StatusWindow(const StatusWindow &);
+                StatusWindow &operator=(const StatusWindow &);
+
+                void push(const double &time, const std::string &status);
+                // drops the statuses at least span seconds older than now
+                void slide(const double &now);
+
+                // 0 if there is neither a success nor a failure in the window
+                double reliability() const;
+
+                const std::deque<std::pair<double, std::string>> &getStatuses() const;
+
+            private:
+                double span;
+                std::deque<std::pair<double, std::string>> statuses;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef EXPONENTIALMOVINGAVERAGE_HPP
+#define EXPONENTIALMOVINGAVERAGE_HPP
+
+#include <string>
+#include <stdint.h>
+#include <sstream>
+
+#include "libbsn/filters/Filter.hpp"
+
+namespace bsn {
+    namespace filters {
+
+        /*
+         * Exponential moving average over range samples, i.e. with smoothing
+         * factor alpha = 2/(range+1). Needs no buffer at all.
+         */
+        class ExponentialMovingAverage : public Filter {
+            public:
+
+                ExponentialMovingAverage(int32_t);
+
+                ExponentialMovingAverage(const ExponentialMovingAverage & /*obj*/);
+                ExponentialMovingAverage &operator=(const ExponentialMovingAverage & /*obj*/);
+
+                double getValue();
+                void insert(double);
+                const std::string toString() const;
+
+                uint32_t getRange() const;
+                void setRange(const uint32_t);
+
+                ExponentialMovingAverage *clone() const;
+
+                double getAlpha() const;
+
+            private:
+                double computedAverage;
+                uint32_t range;
+                double alpha;
+                bool empty;
+        };
+
+    }
+}
+#endif
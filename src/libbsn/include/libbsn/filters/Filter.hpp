@@ -0,0 +1,36 @@
+#ifndef FILTER_HPP
+#define FILTER_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <stdint.h>
+
+namespace bsn {
+    namespace filters {
+
+        /*
+         * Window filter applied by the sensors to every collected value.
+         * range is the number of samples the filter works on.
+         */
+        class Filter {
+            public:
+                virtual ~Filter() {}
+
+                virtual void insert(double) = 0;
+                virtual double getValue() = 0;
+
+                virtual uint32_t getRange() const = 0;
+                virtual void setRange(const uint32_t) = 0;
+
+                virtual Filter *clone() const = 0;
+                virtual const std::string toString() const = 0;
+        };
+
+        // type is one of "moving_average", "exponential" or "median", throws std::invalid_argument otherwise
+        std::unique_ptr<Filter> make_filter(const std::string &type, const uint32_t &range);
+
+    }
+}
+
+#endif
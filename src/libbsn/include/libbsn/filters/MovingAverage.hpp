@@ -1,15 +1,23 @@
 #ifndef MOVINGAVERAGE_HPP
 #define MOVINGAVERAGE_HPP
 
-#include <list>
+#include <vector>
 #include <string>
 #include <stdint.h>
 #include <sstream>
 
+#include "libbsn/filters/Filter.hpp"
+
 namespace bsn {
     namespace filters {
 
-        class MovingAverage { 
+        /*
+         * Average of the last range samples. Samples are kept in a ring and
+         * the sum is updated on every insert (Kahan compensated, and rebuilt
+         * once per lap of the ring so that it does not drift as samples come
+         * in and out), both operations are O(1) amortized.
+         */
+        class MovingAverage : public Filter { 
             public:
 
                 MovingAverage();
@@ -25,16 +33,25 @@ namespace bsn {
                 uint32_t getRange() const;
                 void setRange(const uint32_t);
 
-                std::list<double> getBuffer();
+                MovingAverage *clone() const;
+
+                // samples in the window, oldest first
+                std::vector<double> getBuffer() const;
             
             private:
+                void add(const double &value);
+
                 double computedAverage;
                 double lastInserted;
                 uint32_t range;
-                std::list<double> buffer;
+                std::vector<double> buffer;
+                uint32_t head;
+                uint32_t count;
+                double sum;
+                double compensation;
                 
         };        
 
     }
 }
-#endif 
\ No newline at end of file
+#endif 
@@ -0,0 +1,54 @@
+#ifndef MOVINGMEDIAN_HPP
+#define MOVINGMEDIAN_HPP
+
+#include <set>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <sstream>
+
+#include "libbsn/filters/Filter.hpp"
+
+namespace bsn {
+    namespace filters {
+
+        /*
+         * Median of the last range samples, robust to outliers such as the
+         * injected noise. The window is split in two balanced ordered halves
+         * (lower and upper), so that inserting a sample and dropping the
+         * oldest one is O(log range) and the median is read in O(1). NaN
+         * samples are dropped, they have no place in an ordered half.
+         */
+        class MovingMedian : public Filter {
+            public:
+
+                MovingMedian(int32_t);
+
+                MovingMedian(const MovingMedian & /*obj*/);
+                MovingMedian &operator=(const MovingMedian & /*obj*/);
+
+                double getValue();
+                void insert(double);
+                const std::string toString() const;
+
+                uint32_t getRange() const;
+                void setRange(const uint32_t);
+
+                MovingMedian *clone() const;
+
+            private:
+                void erase(const double &value);
+                void balance();
+
+                double computedMedian;
+                uint32_t range;
+                std::vector<double> buffer;
+                uint32_t head;
+                uint32_t count;
+                std::multiset<double> lower;
+                std::multiset<double> upper;
+        };
+
+    }
+}
+#endif
@@ -2,8 +2,9 @@
 #define DATAGENERATOR_HPP
 
 #include "libbsn/generator/Markov.hpp"
+#include "libbsn/random/Philox.hpp"
 
-#include <random>
+#include <stddef.h>
 #include <stdint.h>
 
 namespace bsn {
@@ -18,15 +19,23 @@ namespace bsn {
                 DataGenerator& operator=(const DataGenerator& obj);
                 
                 double getValue();
+                // seeds from the system entropy source, not reproducible
                 void setSeed();
+                // seeds the stream of this generator, e.g. with bsn::random::seed_for
+                void setSeed(const uint64_t &seed);
                 void nextState();
 
+                // n values in a row, moving to the next state before every period-th one
+                // (as nextState() followed by period getValue()), from a single bulk draw
+                // throws std::invalid_argument if period is 0
+                void generate(const size_t &n, double *out, const size_t &period = 1);
+
             private:
                 double calculateValue();
 
                 Markov markovChain;
                 double value;
-                std::mt19937 seed;
+                bsn::random::Philox rng;
         };
     }
 }
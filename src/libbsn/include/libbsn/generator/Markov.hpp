@@ -2,47 +2,81 @@
 #define MARKOV_HPP
 
 #include <iostream>
-#include <array> 
 #include <random>
 #include <vector>
 #include <stdint.h>
+#include <stddef.h>
 #include <sstream>
 
 #include "libbsn/range/Range.hpp"
+#include "libbsn/random/Philox.hpp"
 
 /*  OBS.: Para simplificação
     O vetor de transições contém as probabilidades de tal forma:
-        
+        transitions[i*n + j] = probabilidade (em %) de ir do estado i para o j
+    Numa linha que soma menos de 100, o restante é a probabilidade de
+    permanecer no estado i (uma linha só de zeros nunca sai dele).
 */
 namespace bsn {
     namespace generator {
 
+        /*
+         * Markov chain of n states, each one with the range its values are
+         * drawn from. Every row of the transition matrix is compiled into an
+         * alias table (Vose), so a transition takes a single uniform draw
+         * and constant time whatever the number of states.
+         */
         class Markov {
             public:
                 Markov();
-                
-                Markov(std::array<float, 25> transitions, std::array<bsn::range::Range, 5> states, int32_t initialState);
+
+                // throws std::invalid_argument unless transitions is states.size() x states.size()
+                // and has no negative probability
+                Markov(const std::vector<double> &transitions, const std::vector<bsn::range::Range> &states, const int32_t &initialState);
 
                 Markov(const Markov & /*obj*/);
                 Markov& operator=(const Markov & /*obj*/);
 
-                // Contém a probabilidade de todas as transições
-                std::array<float,25> transitions;
-                // 0 para low 1 para medium e 2 para high
-                int32_t currentState;
-                // Contém os intervalos de cada estado
-                std::array<bsn::range::Range, 5> states;
+                size_t size() const;
+                const std::vector<double> &getTransitions() const;
+                const std::vector<bsn::range::Range> &getStates() const;
+
+                int32_t getCurrentState() const;
+                void setCurrentState(const int32_t &/*state*/);
+
+                // Calcula o próximo estado da cadeia de markov, u uniforme em [0,1)
+                void next_state(const double &u);
+                // Calcula um valor baseado no intervalo do estado atual, u uniforme em [0,1)
+                // throws std::out_of_range if the current state is not one of the chain
+                double calculate_state(const double &u) const;
+                // n values of the current state at once, out[i] from u[i]
+                void calculate_states(const size_t &n, const double *u, double *out) const;
 
-                // Calcula o próximo estado da cadeia de markov
-                void next_state();
-                // Calcula um valor baseado no intervalo do estado atual
-                double calculate_state();
+                // n transitions in a row, out[i] is the state reached by the i-th one
+                void generate(const size_t &n, int32_t *out, bsn::random::Philox &rng);
 
                 const std::string toString() const;
+
+            private:
+                void build();
+                void checkState() const;
+
+                // Contém a probabilidade de todas as transições
+                std::vector<double> transitions;
+                // Contém os intervalos de cada estado
+                std::vector<bsn::range::Range> states;
+                int32_t currentState;
+
+                // alias tables, one row of size() columns per state
+                std::vector<double> probability;
+                std::vector<int32_t> alias;
+                // bounds of the ranges, values are lower + u * width
+                std::vector<double> lower;
+                std::vector<double> width;
         };
 
     }
 
 }
 
-#endif
\ No newline at end of file
+#endif
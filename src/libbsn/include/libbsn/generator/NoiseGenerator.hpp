@@ -0,0 +1,42 @@
+#ifndef NOISEGENERATOR_HPP
+#define NOISEGENERATOR_HPP
+
+#include <vector>
+#include <stdint.h>
+
+#include "libbsn/random/Xoshiro256.hpp"
+
+namespace bsn {
+    namespace generator {
+
+        /*
+         * Measurement noise of the sensors. A noisy replica of a value is
+         *     data +- (noise_factor + U(0,1) * noise_factor) * data
+         * where the sign is drawn with even odds.
+         */
+        class NoiseGenerator {
+            public:
+                NoiseGenerator();
+                NoiseGenerator(const uint64_t &seed);
+
+                NoiseGenerator(const NoiseGenerator & /*obj*/);
+                NoiseGenerator &operator=(const NoiseGenerator & /*obj*/);
+
+                // one noisy replica of data
+                double apply(const double &data, const double &noise_factor);
+
+                // average of replicas noisy replicas of data: the noise terms are drawn
+                // into a contiguous buffer and then reduced, rather than one at a time
+                double replicate(const double &data, const double &noise_factor, const uint32_t &replicas);
+
+            private:
+                double draw();
+
+                bsn::random::Xoshiro256 rng;
+                std::vector<double> buffer;
+        };
+
+    }
+}
+
+#endif
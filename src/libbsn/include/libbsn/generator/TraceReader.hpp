@@ -0,0 +1,46 @@
+#ifndef TRACEREADER_HPP
+#define TRACEREADER_HPP
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+#include "libbsn/generator/TraceWriter.hpp"
+
+namespace bsn {
+    namespace generator {
+
+        /*
+         * Read-only view over a trace written by TraceWriter. The file is
+         * memory mapped, so samples are paged in on demand and never copied.
+         */
+        class TraceReader {
+            public:
+                TraceReader(const std::string &path);
+                ~TraceReader();
+
+            private:
+                TraceReader(const TraceReader &);
+                TraceReader &operator=(const TraceReader &);
+
+            public:
+                const std::vector<std::string> &getChannels() const;
+                uint32_t getChannelIndex(const std::string &channel) const;
+                double getFrequency() const;
+                uint64_t getSamples() const;
+
+                double at(const uint64_t &sample, const uint32_t &channel) const;
+                const float *row(const uint64_t &sample) const;
+
+            private:
+                void *mapping;
+                size_t length;
+                TraceHeader header;
+                std::vector<std::string> channels;
+                const float *data;
+        };
+    }
+}
+
+#endif
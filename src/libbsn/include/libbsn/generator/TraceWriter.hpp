@@ -0,0 +1,56 @@
+#ifndef TRACEWRITER_HPP
+#define TRACEWRITER_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <stdint.h>
+
+namespace bsn {
+    namespace generator {
+
+        /*
+         * Binary vital sign trace, replayed by TraceReader.
+         *
+         * Layout (host byte order):
+         *   header   "BSNT", uint32 version, uint32 channels, uint32 reserved,
+         *            float64 frequency, uint64 samples
+         *   names    per channel: uint32 length + characters, padded to 8 bytes
+         *   samples  float32 [samples][channels], row major
+         */
+        struct TraceHeader {
+            char magic[4];
+            uint32_t version;
+            uint32_t channels;
+            uint32_t reserved;
+            double frequency;
+            uint64_t samples;
+        };
+
+        class TraceWriter {
+            public:
+                TraceWriter(const std::string &path, const std::vector<std::string> &channels, const double &frequency);
+                ~TraceWriter();
+
+            private:
+                TraceWriter(const TraceWriter &);
+                TraceWriter &operator=(const TraceWriter &);
+
+            public:
+                // appends one sample of every channel, in channel order
+                void append(const std::vector<double> &row);
+                void append(const double *row);
+                void close();
+
+                uint64_t getSamples() const;
+
+            private:
+                std::ofstream file;
+                TraceHeader header;
+                std::vector<float> buffer;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace bsn {
+    namespace random {
+
+        /*
+         * Philox4x32-10 counter-based generator (Salmon et al., Random123).
+         *
+         * Every block of four 32 bit words is a pure function of (seed,
+         * stream, block index), so each component draws from its own
+         * stream of the same seed without sharing any state, and a run is
+         * reproducible whatever the order in which threads interleave.
+         */
+        class Philox {
+            public:
+                Philox();
+                Philox(const uint64_t &seed, const uint64_t &stream = 0);
+
+                Philox(const Philox & /*obj*/);
+                Philox &operator=(const Philox & /*obj*/);
+
+                void seed(const uint64_t &seed, const uint64_t &stream = 0);
+
+                // jumps to the given block, in O(1)
+                void seek(const uint64_t &block);
+                uint64_t tell() const;
+
+                uint32_t next();
+                // uniform in [0,1)
+                double uniform();
+                // uniform in [lower,upper)
+                double uniform(const double &lower, const double &upper);
+                // uniform in [lower,upper]
+                int32_t uniform_int(const int32_t &lower, const int32_t &upper);
+
+                // n uniform values in [0,1), two per block
+                void fill(double *out, const size_t &n);
+                void fill(uint32_t *out, const size_t &n);
+
+            private:
+                std::array<uint32_t, 4> generate(const uint64_t &index) const;
+
+                std::array<uint32_t, 2> key;
+                uint64_t stream;
+                uint64_t block;
+                std::array<uint32_t, 4> output;
+                uint32_t used;
+        };
+
+    }
+}
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef SEED_HPP
+#define SEED_HPP
+
+#include <string>
+#include <stdint.h>
+
+namespace bsn {
+    namespace random {
+
+        // stable 64 bit identifier of a name (FNV-1a), the same on every platform and run
+        uint64_t stream_id(const std::string &name);
+
+        // seed of the generator of component name, derived from the seed of the whole run
+        uint64_t seed_for(const uint64_t &seed, const std::string &name);
+
+        // a fresh non reproducible seed, for runs that were not given one
+        uint64_t random_seed();
+
+    }
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef XOSHIRO256_HPP
+#define XOSHIRO256_HPP
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace bsn {
+    namespace random {
+
+        /*
+         * xoshiro256** pseudo random number generator (Blackman & Vigna).
+         * Much cheaper than std::mt19937 or rand(), with a 256 bit state
+         * that each component owns, so no locking is ever needed.
+         */
+        class Xoshiro256 {
+            public:
+                Xoshiro256();
+                Xoshiro256(const uint64_t &seed);
+
+                Xoshiro256(const Xoshiro256 & /*obj*/);
+                Xoshiro256 &operator=(const Xoshiro256 & /*obj*/);
+
+                // the whole state is derived from seed (splitmix64)
+                void seed(const uint64_t &seed);
+
+                uint64_t next();
+                // uniform in [0,1)
+                double uniform();
+                // n uniform values in [0,1)
+                void fill(double *out, const size_t &n);
+
+            private:
+                std::array<uint64_t, 4> state;
+        };
+
+    }
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef COLUMNREADER_HPP
+#define COLUMNREADER_HPP
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+#include "libbsn/storage/ColumnWriter.hpp"
+
+namespace bsn {
+    namespace storage {
+
+        /*
+         * Read-only view over a log written by ColumnWriter. The file is
+         * memory mapped and only the chunks of the columns read are paged
+         * in, so scanning one column of a long log reads a fraction of it.
+         * A block cut short (e.g. by a crash while writing it) is left out.
+         */
+        class ColumnReader {
+            public:
+                ColumnReader(const std::string &path);
+                ~ColumnReader();
+
+            private:
+                ColumnReader(const ColumnReader &);
+                ColumnReader &operator=(const ColumnReader &);
+
+            public:
+                uint64_t getRows() const;
+                size_t getBlocks() const;
+                // rows and range of logical clocks and timestamps of a block, to skip it
+                const ColumnBlockHeader &getBlock(const size_t &block) const;
+
+                // LOGICAL_CLOCK or TIMESTAMP, appended to values; throws std::invalid_argument
+                // for another column or a corrupt chunk
+                void read(const size_t &block, const Column &column, std::vector<int64_t> &values) const;
+                // NAME, SOURCE, TARGET or CONTENT, appended to values
+                void read(const size_t &block, const Column &column, std::vector<std::string> &values) const;
+                // NAME, SOURCE, TARGET or CONTENT as codes into the dictionary of the block,
+                // cheaper to filter on than the values
+                void read(const size_t &block, const Column &column, std::vector<uint32_t> &codes, std::vector<std::string> &dictionary) const;
+
+                // the column over all blocks
+                void read(const Column &column, std::vector<int64_t> &values) const;
+                void read(const Column &column, std::vector<std::string> &values) const;
+
+            private:
+                const char *chunk(const size_t &block, const Column &column) const;
+
+                void *mapping;
+                size_t length;
+                std::vector<ColumnBlockHeader> blocks;
+                std::vector<const char *> offsets;
+                uint64_t rows;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef COLUMNWRITER_HPP
+#define COLUMNWRITER_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <stdint.h>
+
+namespace bsn {
+    namespace storage {
+
+        // the fields of a DataAccess log line, in order
+        enum Column { NAME, LOGICAL_CLOCK, TIMESTAMP, SOURCE, TARGET, CONTENT, COLUMNS };
+
+        /*
+         * Columnar copy of a DataAccess log, read by ColumnReader.
+         *
+         * Layout (host byte order):
+         *   header   "BSNC", uint32 version, uint32 columns, uint32 reserved
+         *   blocks   ColumnBlockHeader, then the chunk of every column in
+         *            column order, of the sizes in the block header
+         *
+         * Logical clocks and timestamps are delta encoded, as zigzag varints.
+         * Names, sources, targets and contents are dictionary encoded: the
+         * distinct values of the block (varint count, then varint length +
+         * characters each), a uint8 code width and the codes bit packed,
+         * least significant bit first. A status takes a bit or two, a name none.
+         */
+        struct ColumnHeader {
+            char magic[4];
+            uint32_t version;
+            uint32_t columns;
+            uint32_t reserved;
+        };
+
+        struct ColumnBlockHeader {
+            uint32_t rows;
+            uint32_t reserved;
+            int64_t min_clock;
+            int64_t max_clock;
+            int64_t min_timestamp;
+            int64_t max_timestamp;
+            uint32_t sizes[COLUMNS];
+        };
+
+        class ColumnWriter {
+            public:
+                ColumnWriter(const std::string &path, const uint32_t &block_rows = 4096);
+                ~ColumnWriter();
+
+            private:
+                ColumnWriter(const ColumnWriter &);
+                ColumnWriter &operator=(const ColumnWriter &);
+
+            public:
+                // rows are written a block at a time, every block_rows rows, on flush and on close
+                void append(const std::string &name, const int64_t &logical_clock, const int64_t &timestamp,
+                            const std::string &source, const std::string &target, const std::string &content);
+                void flush();
+                void close();
+
+                uint64_t getRows() const;
+
+            private:
+                // the distinct values of a string column in the block, and the code of every row
+                struct Dictionary {
+                    std::map<std::string, uint32_t> index;
+                    std::vector<std::string> values;
+                    std::vector<uint32_t> codes;
+                };
+
+                void add(Dictionary &dictionary, const std::string &value);
+
+                std::ofstream file;
+                uint32_t block_rows;
+                uint64_t rows;
+
+                std::vector<int64_t> clocks;
+                std::vector<int64_t> timestamps;
+                Dictionary names, sources, targets, contents;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef COMPRESSION_HPP
+#define COMPRESSION_HPP
+
+#include <string>
+#include <stdexcept>
+#include <stddef.h>
+
+namespace bsn {
+    namespace storage {
+
+        /*
+         * Block compression in the LZ4 block format: greedy matching over a
+         * 4 KiB hash table, fast to compress and faster to decompress, which
+         * is what the repetitive lines of the logs need.
+         */
+
+        // appends the compressed block to out
+        void compress(const char *data, const size_t &size, std::string &out);
+        // the block must decompress to exactly size bytes, throws std::invalid_argument otherwise
+        void decompress(const char *data, const size_t &compressed, char *out, const size_t &size);
+    }
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef SEGMENTREADER_HPP
+#define SEGMENTREADER_HPP
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+#include "libbsn/storage/SegmentedLog.hpp"
+
+namespace bsn {
+    namespace storage {
+
+        // a line of <name>.idx
+        struct SegmentIndex {
+            uint32_t segment;
+            uint64_t rows;
+            int64_t min_clock;
+            int64_t max_clock;
+            int64_t min_timestamp;
+            int64_t max_timestamp;
+        };
+
+        /*
+         * Reads the lines of a log written by SegmentedLog, segment after
+         * segment, compressed or not. Given a range of timestamps, segments
+         * and frames out of it are skipped by their index and headers,
+         * without being decompressed.
+         */
+        class SegmentReader {
+            public:
+                SegmentReader(const std::string &dir, const std::string &name);
+                ~SegmentReader();
+
+            private:
+                SegmentReader(const SegmentReader &);
+                SegmentReader &operator=(const SegmentReader &);
+
+            public:
+                // whether <dir>/<name> was written in segments
+                static bool exists(const std::string &dir, const std::string &name);
+
+                // the compressed segments, as indexed when the reader was made
+                const std::vector<SegmentIndex> &getSegments() const;
+
+                // back to the first line, of those with timestamps in [from, to]
+                void seek(const int64_t &from, const int64_t &to);
+                // the next line, without the newline; false once there are no more
+                bool next(std::string &line);
+
+            private:
+                bool open();
+                bool frame();
+                bool inRange(const std::string &line) const;
+
+                std::string dir;
+                std::string name;
+                std::vector<SegmentIndex> segments;
+                std::map<uint32_t, size_t> indexed;
+
+                int64_t from;
+                int64_t to;
+
+                // the next segment to open
+                uint32_t segment;
+                std::ifstream file;
+                bool compressed;
+                uint32_t frames;
+
+                std::string lines;
+                size_t position;
+                // the whole frame is in range, its lines need no check
+                bool inside;
+        };
+    }
+}
+
+#endif
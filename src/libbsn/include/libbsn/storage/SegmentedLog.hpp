@@ -0,0 +1,107 @@
+#ifndef SEGMENTEDLOG_HPP
+#define SEGMENTEDLOG_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <stdexcept>
+#include <stdint.h>
+
+#include "libbsn/utils/StringView.hpp"
+
+namespace bsn {
+    namespace storage {
+
+        /*
+         * A log (e.g. status_<id>) written in segments: lines go to the plain
+         * text segment <dir>/<name>.<n>.log until it reaches max_bytes or
+         * max_seconds, then it is compressed in the background to
+         * <name>.<n>.seg and the next one starts. Each compressed segment gets
+         * a line in <name>.idx with its rows and range of logical clocks and
+         * timestamps, read by SegmentReader to seek without decompressing the
+         * rest.
+         *
+         * Compressed segment layout (host byte order):
+         *   header   "BSNS", uint32 version, uint32 frames, uint32 reserved
+         *   frames   SegmentFrame, then the frame compressed (see Compression),
+         *            or as is when it does not get any smaller
+         *
+         * A frame holds whole lines, up to frame_bytes of them. A segment
+         * that fails to compress is left as plain text, which readers read
+         * as well.
+         */
+        struct SegmentHeader {
+            char magic[4];
+            uint32_t version;
+            uint32_t frames;
+            uint32_t reserved;
+        };
+
+        struct SegmentFrame {
+            uint32_t size;
+            uint32_t compressed;
+            uint32_t rows;
+            uint32_t reserved;
+            int64_t min_clock;
+            int64_t max_clock;
+            int64_t min_timestamp;
+            int64_t max_timestamp;
+        };
+
+        class SegmentedLog {
+            public:
+                // max_bytes or max_seconds 0 do not rotate on size or time; starts an empty
+                // <name>.idx, throws std::runtime_error if it cannot
+                SegmentedLog(const std::string &dir, const std::string &name, const uint64_t &max_bytes, const double &max_seconds);
+                ~SegmentedLog();
+
+            private:
+                SegmentedLog(const SegmentedLog &);
+                SegmentedLog &operator=(const SegmentedLog &);
+
+            public:
+                // a line of the log, without the newline; rotates the segment if it is full or old enough
+                void append(const std::string &line);
+                // makes the lines appended so far readable
+                void flush();
+                // queues the current segment for compression and starts the next one
+                void rotate();
+                // rotates and waits for the compression of every segment
+                void close();
+
+                static const uint32_t frame_bytes;
+
+                // <dir>/<name>.<segment>.<extension>
+                static std::string path(const std::string &dir, const std::string &name, const uint32_t &segment, const std::string &extension);
+                // compresses a plain segment and indexes it, as the background thread does
+                static void compress(const std::string &dir, const std::string &name, const uint32_t &segment);
+                // the logical clock and timestamp of a line, name,logical clock,timestamp,...
+                static bool clocks(const bsn::utils::StringView &line, int64_t &clock, int64_t &timestamp);
+
+            private:
+                void work();
+
+                std::string dir;
+                std::string name;
+                uint64_t max_bytes;
+                double max_seconds;
+
+                std::ofstream file;
+                uint32_t segment;
+                uint64_t bytes;
+                std::chrono::steady_clock::time_point opened;
+
+                std::mutex mutex;
+                std::condition_variable pending;
+                std::deque<uint32_t> queue;
+                bool closing;
+                std::thread worker;
+        };
+    }
+}
+
+#endif
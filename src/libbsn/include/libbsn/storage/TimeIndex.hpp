@@ -0,0 +1,83 @@
+#ifndef TIMEINDEX_HPP
+#define TIMEINDEX_HPP
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+namespace bsn {
+    namespace storage {
+
+        /*
+         * Sparse index of a plain text log of the knowledge repository
+         * (name,logical clock,timestamp,...): the log is cut in blocks of
+         * `every` lines, and each block is kept with its offset in the log and
+         * its range of logical clocks and timestamps, so that a query reads
+         * only the blocks it needs.
+         *
+         * The blocks are appended to an index file as they fill up, and the
+         * lines after the last of them are indexed again on every update, so
+         * the index follows a log that is still being written. The index file
+         * is rebuilt if it does not match the log.
+         *
+         * Index layout (host byte order):
+         *   header   "BSNI", uint32 version, uint32 every, uint32 reserved
+         *   blocks   TimeIndexBlock, one after the other
+         */
+        struct TimeIndexHeader {
+            char magic[4];
+            uint32_t version;
+            uint32_t every;
+            uint32_t reserved;
+        };
+
+        struct TimeIndexBlock {
+            uint64_t offset;
+            uint32_t rows;
+            uint32_t size;
+            int64_t min_clock;
+            int64_t max_clock;
+            int64_t min_timestamp;
+            int64_t max_timestamp;
+        };
+
+        class TimeIndex {
+            public:
+                // throws std::runtime_error if the index cannot be written
+                TimeIndex(const std::string &log, const std::string &index, const uint32_t &every = 1024);
+                ~TimeIndex();
+
+            private:
+                TimeIndex(const TimeIndex &);
+                TimeIndex &operator=(const TimeIndex &);
+
+            public:
+                // indexes the whole lines appended to the log since the last update
+                void update();
+
+                // the blocks, the last one possibly not full yet, in the order of the log
+                const std::vector<TimeIndexBlock> &getBlocks() const;
+                // the blocks with timestamps in [from, to]
+                std::vector<TimeIndexBlock> find(const int64_t &from, const int64_t &to) const;
+                // offset of the block holding a logical clock, or of the first one after
+                // it; the size of the indexed log if there is none
+                uint64_t seek(const int64_t &clock) const;
+
+            private:
+                void load();
+                void rewrite();
+                uint64_t end() const;
+
+                std::string log;
+                std::string index;
+                uint32_t every;
+
+                // the full blocks, in the index file, then the lines after them
+                std::vector<TimeIndexBlock> blocks;
+                size_t full;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef STRINGVIEW_HPP
+#define STRINGVIEW_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <stddef.h>
+#include <string>
+
+namespace bsn {
+    namespace utils {
+
+        /*
+         * Non-owning view of a run of characters, a C++11 stand-in for
+         * std::string_view. The viewed string must outlive the view.
+         */
+        class StringView {
+            public:
+                static const size_t npos = static_cast<size_t>(-1);
+
+                StringView() : first(0), length(0) {}
+                StringView(const char *text) : first(text), length(std::strlen(text)) {}
+                StringView(const char *text, const size_t &size) : first(text), length(size) {}
+                StringView(const std::string &text) : first(text.data()), length(text.size()) {}
+
+                const char *data() const { return first; }
+                size_t size() const { return length; }
+                bool empty() const { return length == 0; }
+
+                const char *begin() const { return first; }
+                const char *end() const { return first + length; }
+                char operator[](const size_t &i) const { return first[i]; }
+
+                size_t find(const char &c, const size_t &pos = 0) const {
+                    if (pos >= length) return npos;
+                    const void *found = std::memchr(first + pos, c, length - pos);
+                    return found ? static_cast<const char *>(found) - first : npos;
+                }
+
+                StringView substr(const size_t &pos, const size_t &n = npos) const {
+                    size_t start = std::min(pos, length);
+                    return StringView(first + start, std::min(n, length - start));
+                }
+
+                std::string str() const { return std::string(first, length); }
+
+            private:
+                const char *first;
+                size_t length;
+        };
+
+        inline bool operator==(const StringView &a, const StringView &b) {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+        }
+
+        inline bool operator!=(const StringView &a, const StringView &b) {
+            return !(a == b);
+        }
+
+        inline std::ostream &operator<<(std::ostream &os, const StringView &view) {
+            return os.write(view.data(), view.size());
+        }
+
+    }
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef TOKENIZER_HPP
+#define TOKENIZER_HPP
+
+#include <iterator>
+
+#include "libbsn/utils/StringView.hpp"
+
+namespace bsn {
+    namespace utils {
+
+        /*
+         * Lazy split of a text on a delimiter, the tokens are views into the
+         * text and are found while iterating, nothing is allocated. Empty
+         * tokens are skipped, as split does:
+         *
+         *     for (StringView pair : Tokenizer(content, ';')) { ... }
+         */
+        class Tokenizer {
+            public:
+                class iterator {
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef StringView value_type;
+                        typedef ptrdiff_t difference_type;
+                        typedef const StringView *pointer;
+                        typedef const StringView &reference;
+
+                        iterator() : text(), delimiter(), token() {}
+                        iterator(const StringView &text, const char &delimiter) : text(text), delimiter(delimiter), token() {
+                            advance();
+                        }
+
+                        const StringView &operator*() const { return token; }
+                        const StringView *operator->() const { return &token; }
+
+                        iterator &operator++() {
+                            advance();
+                            return *this;
+                        }
+
+                        iterator operator++(int) {
+                            iterator previous(*this);
+                            advance();
+                            return previous;
+                        }
+
+                        bool operator==(const iterator &other) const { return token.data() == other.token.data(); }
+                        bool operator!=(const iterator &other) const { return !(*this == other); }
+
+                    private:
+                        void advance() {
+                            const char *position = token.data() ? token.end() : text.begin();
+                            const char *end = text.end();
+
+                            while (position != end && *position == delimiter) ++position;
+                            if (position == end) {
+                                token = StringView();
+                                return;
+                            }
+
+                            const char *stop = position;
+                            while (stop != end && *stop != delimiter) ++stop;
+                            token = StringView(position, stop - position);
+                        }
+
+                        StringView text;
+                        char delimiter;
+                        StringView token;
+                };
+
+                Tokenizer(const StringView &text, const char &delimiter) : text(text), delimiter(delimiter) {}
+
+                iterator begin() const { return iterator(text, delimiter); }
+                iterator end() const { return iterator(); }
+
+            private:
+                StringView text;
+                char delimiter;
+        };
+
+    }
+}
+
+#endif
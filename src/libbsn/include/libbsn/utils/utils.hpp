@@ -3,14 +3,33 @@
 
 #include<vector>
 #include<string>
+#include<stdint.h>
+
+#include "libbsn/utils/StringView.hpp"
+#include "libbsn/utils/Tokenizer.hpp"
 
 namespace bsn {
     namespace utils {
         
         const std::vector<std::string> split(const std::string&, const char&);
+
+        // Splits text at the first delimiter, false if there is none
+        bool split_once(const StringView &text, const char &delimiter, StringView &first, StringView &second);
+
+        // As std::stod and std::stoi, on a view and without allocating:
+        // leading blanks are skipped, the number ends at the first character
+        // that does not belong to it. Throw std::invalid_argument if there is no
+        // number and std::out_of_range if it does not fit
+        double to_double(const StringView &text);
+        int32_t to_int(const StringView &text);
+
+        // Strict versions, false unless the whole text is a number that fits
+        bool parse(const StringView &text, double &value);
+        bool parse(const StringView &text, int32_t &value);
+        bool parse(const StringView &text, int64_t &value);
         
     }
 }
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,109 @@
+#include "libbsn/analysis/History.hpp"
+
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "libbsn/storage/SegmentReader.hpp"
+#include "libbsn/utils/utils.hpp"
+
+using namespace bsn::utils;
+
+namespace bsn {
+    namespace analysis {
+
+        namespace {
+            // more would not fit in a reply to the engines anyway
+            const int64_t max_buckets = 100000;
+
+            // /g3t1_3 and g3t1_3 are the same component, the energy statuses are logged without the slash
+            StringView component(const StringView &name) {
+                return !name.empty() && name[0] == '/' ? name.substr(1) : name;
+            }
+
+            // the sum and count of the values of each bucket
+            typedef std::map<std::string, std::vector<std::pair<double, uint64_t>>> Buckets;
+        }
+
+        History::History(const std::string &dir, const std::string &id) : dir(dir), id(id), indexes() {}
+
+        History::~History() {}
+
+        std::map<std::string, std::vector<double>> History::reliability(const std::string &component, const int64_t &from, const int64_t &to, const int64_t &bucket) {
+            return aggregate("status", component, from, to, bucket);
+        }
+
+        std::map<std::string, std::vector<double>> History::cost(const std::string &component, const int64_t &from, const int64_t &to, const int64_t &bucket) {
+            return aggregate("energystatus", component, from, to, bucket);
+        }
+
+        std::map<std::string, std::vector<double>> History::aggregate(const std::string &log, const std::string &name,
+                                                                      const int64_t &from, const int64_t &to, const int64_t &bucket) {
+            if (bucket <= 0) throw std::invalid_argument("bucket must be positive");
+            if (to <= from) throw std::invalid_argument("empty range of timestamps");
+            if (static_cast<uint64_t>(to - from) / bucket >= static_cast<uint64_t>(max_buckets)) throw std::invalid_argument("too many buckets");
+            size_t buckets = (static_cast<uint64_t>(to - from) + bucket - 1) / bucket;
+
+            bool costs = log == "energystatus";
+            StringView wanted = component(name);
+            Buckets values;
+
+            StringView type, rest, clock, timestamp, source, target, content;
+            auto add = [&](const StringView &line) {
+                if (!split_once(line, ',', type, rest) || type != (costs ? "EnergyStatus" : "Status")) return;
+                if (!split_once(rest, ',', clock, rest) || !split_once(rest, ',', timestamp, rest) ||
+                    !split_once(rest, ',', source, rest) || !split_once(rest, ',', target, content)) return;
+                if (!wanted.empty() && component(source) != wanted) return;
+
+                int64_t time;
+                if (!parse(timestamp, time) || time < from || time >= to) return;
+
+                double value;
+                if (costs) {
+                    if (!parse(content, value)) return;
+                } else if (content == "success" || content == "fail") {
+                    value = content == "success";
+                } else {
+                    return;
+                }
+
+                std::vector<std::pair<double, uint64_t>> &series = values[source.str()];
+                if (series.empty()) series.resize(buckets, std::make_pair(0.0, uint64_t(0)));
+                std::pair<double, uint64_t> &b = series[static_cast<uint64_t>(time - from) / bucket];
+                b.first += value;
+                ++b.second;
+            };
+
+            std::string file = log + "_" + id;
+            std::string line;
+            if (bsn::storage::SegmentReader::exists(dir, file)) {
+                bsn::storage::SegmentReader reader(dir, file);
+                reader.seek(from, to - 1);
+                while (reader.next(line)) add(line);
+            } else {
+                std::shared_ptr<bsn::storage::TimeIndex> &index = indexes[file];
+                std::ifstream in(dir + "/" + file + ".log", std::ios::binary);
+                if (!in.is_open()) throw std::runtime_error("could not open " + dir + "/" + file + ".log");
+
+                if (!index) index.reset(new bsn::storage::TimeIndex(dir + "/" + file + ".log", dir + "/" + file + ".tix"));
+                index->update();
+
+                for (const bsn::storage::TimeIndexBlock &block : index->find(from, to - 1)) {
+                    in.clear();
+                    in.seekg(block.offset);
+                    for (uint32_t i = 0; i < block.rows && std::getline(in, line); ++i) add(line);
+                }
+            }
+
+            std::map<std::string, std::vector<double>> result;
+            for (const Buckets::value_type &series : values) {
+                std::vector<double> &means = result[series.first];
+                for (const std::pair<double, uint64_t> &b : series.second) {
+                    means.push_back(b.second ? b.first / b.second : std::numeric_limits<double>::quiet_NaN());
+                }
+            }
+            return result;
+        }
+    }
+}
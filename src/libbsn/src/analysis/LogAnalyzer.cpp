@@ -0,0 +1,364 @@
+#include "libbsn/analysis/LogAnalyzer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "libbsn/storage/SegmentReader.hpp"
+#include "libbsn/utils/utils.hpp"
+
+using namespace bsn::utils;
+
+namespace bsn {
+    namespace analysis {
+
+        namespace {
+            // name,logical clock,timestamp,source,target,content; as the csv module
+            // reads them, the content ends at the next comma
+            bool fields(const StringView &line, StringView (&field)[6]) {
+                size_t start = 0;
+                for (int i = 0; i < 6; ++i) {
+                    size_t comma = line.find(',', start);
+                    if (comma == StringView::npos && i < 5) return false;
+                    field[i] = line.substr(start, comma == StringView::npos ? StringView::npos : comma - start);
+                    start = comma + 1;
+                }
+                return true;
+            }
+
+            // as int(), the whole field must be the number
+            int64_t integer(const StringView &text) {
+                const char *c = text.begin(), *end = text.end();
+                while (c != end && std::isspace(static_cast<unsigned char>(*c))) ++c;
+                bool negative = c != end && *c == '-';
+                if (c != end && (*c == '-' || *c == '+')) ++c;
+
+                const char *digits = c;
+                int64_t value = 0;
+                for (; c != end && *c >= '0' && *c <= '9'; ++c) value = 10 * value + (*c - '0');
+                if (c == digits) throw std::invalid_argument("not an integer: " + text.str());
+
+                while (c != end && std::isspace(static_cast<unsigned char>(*c))) ++c;
+                if (c != end) throw std::invalid_argument("not an integer: " + text.str());
+                return negative ? -value : value;
+            }
+
+            // the lines of <dir>/<name>.log, or of its segments if DataAccess rotated it
+            class Lines {
+                public:
+                    Lines(const std::string &dir, const std::string &name) : file(), segments() {
+                        if (bsn::storage::SegmentReader::exists(dir, name)) {
+                            segments.reset(new bsn::storage::SegmentReader(dir, name));
+                            return;
+                        }
+                        file.open(dir + "/" + name + ".log");
+                        if (!file) throw std::runtime_error("could not open " + dir + "/" + name + ".log");
+                        std::string blank;
+                        std::getline(file, blank); // the first line is left blank
+                    }
+
+                    bool next(std::string &line) {
+                        return segments ? segments->next(line) : static_cast<bool>(std::getline(file, line));
+                    }
+
+                private:
+                    Lines(const Lines &);
+                    Lines &operator=(const Lines &);
+
+                    std::ifstream file;
+                    std::unique_ptr<bsn::storage::SegmentReader> segments;
+            };
+
+            // one log, read a line ahead to be merged in logical order with the others
+            struct Log {
+                Lines lines;
+                std::string path;
+                std::string line;
+                int64_t clock;
+                bool open;
+
+                Log(const std::string &dir, const std::string &name) : lines(dir, name), path(dir + "/" + name), line(), clock(std::numeric_limits<int64_t>::min()), open(true) {
+                    next();
+                }
+
+                void next() {
+                    StringView field[6];
+                    while (lines.next(line)) {
+                        if (line.empty() || !fields(line, field)) continue;
+
+                        int64_t previous = clock;
+                        clock = integer(field[1]);
+                        if (clock < previous) throw std::runtime_error(path + " is not in logical order");
+                        return;
+                    }
+                    open = false;
+                }
+            };
+        }
+
+        const int64_t LogAnalyzer::window = 25000000000; // 2.5 * 10e9 ns, as Analyzer.py has it
+        const double LogAnalyzer::stability_margin = 0.02;
+
+        LogAnalyzer::LogAnalyzer(const std::string &text, const std::string &metric, const double &setpoint) :
+            expression(),
+            reliability(metric == "reliability"),
+            setpoint(setpoint),
+            tasks(),
+            task_order(),
+            contexts(),
+            deactivated(),
+            ignored(),
+            started(false),
+            t0(0),
+            triggered(std::numeric_limits<int64_t>::max()),
+            adapted(),
+            curve(),
+            curve_index() {
+            if (metric != "reliability" && metric != "cost") throw std::invalid_argument("metric is not reliability or cost: " + metric);
+
+            expression = bsn::model::Formula(text).getExpression();
+            for (const std::string &variable : expression.getVariables()) {
+                expression.getVariableReference(variable) = 0;
+            }
+        }
+
+        LogAnalyzer::~LogAnalyzer() {}
+
+        std::string LogAnalyzer::tag(const StringView &name) {
+            // /g3t1_1 -> G3_T1_1
+            std::string tag;
+            for (char c : name) {
+                c = std::toupper(static_cast<unsigned char>(c));
+                if (c == '/') continue;
+                if (c == '.') c = '_';
+                if (c == 'T') tag += '_';
+                tag += c;
+            }
+            return tag;
+        }
+
+        double *LogAnalyzer::term(const std::string &name) {
+            const std::set<std::string> &variables = expression.getVariables();
+            return variables.count(name) ? &expression.getVariableReference(name) : 0;
+        }
+
+        void LogAnalyzer::deactivate(const std::string &source) {
+            // /g3t1_1 -> G3_T1_1, the way the script names deactivated components
+            std::string name = source.substr(std::min<size_t>(1, source.size()));
+            std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+            if (name.size() > 2) name.insert(2, "_");
+            if (!deactivated.insert(name).second) return;
+
+            double *t = term((reliability ? "R_" : "W_") + name);
+            if (t) ignored.push_back(std::make_pair(t, reliability ? 1.0 : 0.0));
+            t = term("CTX_" + name);
+            if (t) ignored.push_back(std::make_pair(t, 1.0));
+        }
+
+        void LogAnalyzer::read(const std::string &dir, const std::string &id) {
+            {
+                Lines events(dir, "event_" + id);
+
+                std::string line;
+                StringView field[6];
+                while (events.next(line)) {
+                    if (fields(line, field) && field[5] == "deactivate") deactivate(field[3].str());
+                }
+            }
+
+            // statuses (or energy statuses) first, then events and adaptations, where
+            // they share a logical clock
+            std::vector<Log *> logs;
+            try {
+                logs.push_back(new Log(dir, (reliability ? "status_" : "energystatus_") + id));
+                logs.push_back(new Log(dir, "event_" + id));
+                logs.push_back(new Log(dir, "adaptation_" + id));
+
+                while (true) {
+                    Log *next = 0;
+                    for (Log *log : logs) {
+                        if (log->open && (!next || log->clock < next->clock)) next = log;
+                    }
+                    if (!next) break;
+
+                    add(next->line);
+                    next->next();
+                }
+            } catch (...) {
+                for (Log *log : logs) delete log;
+                throw;
+            }
+            for (Log *log : logs) delete log;
+        }
+
+        void LogAnalyzer::add(const StringView &line) {
+            StringView field[6];
+            if (!fields(line, field)) return;
+
+            int64_t timestamp = integer(field[2]);
+            if (!started) {
+                t0 = timestamp;
+                started = true;
+            }
+            int64_t instant = timestamp - t0;
+
+            if (field[0] == "Adaptation") {
+                // the first adaptation of each component, the earliest of them triggers the analysis
+                if (adapted.insert(tag(field[4])).second) triggered = std::min(triggered, timestamp);
+            } else if (field[0] == "Status") {
+                status(instant, field[3], field[5]);
+            } else if (field[0] == "EnergyStatus") {
+                double cost;
+                if (field[3] == "global" && parse(field[5], cost)) point(instant, cost);
+            } else if (field[0] == "Event") {
+                event(field[3], field[5]);
+            }
+
+            if (reliability && (field[0] == "Status" || field[0] == "Event")) point(instant, evaluate());
+        }
+
+        void LogAnalyzer::status(const int64_t &instant, const StringView &source, const StringView &content) {
+            std::string name = tag(source);
+            std::map<std::string, Task>::iterator it = tasks.find(name);
+            if (it == tasks.end()) {
+                Task task = {std::vector<std::pair<int64_t, int>>(), 0, 0, true, 0, term("R_" + name), 0};
+                it = tasks.insert(std::make_pair(name, task)).first;
+                task_order.push_back(&it->second);
+            }
+
+            if (content != "success" && content != "fail") return;
+            Task &task = it->second;
+
+            int ok = content == "success";
+            if (!task.invocations.empty() && instant < task.invocations.back().first) task.ordered = false;
+            task.invocations.push_back(std::make_pair(instant, ok));
+
+            int64_t count = 0, successes = 0;
+            if (task.ordered) {
+                // in time order, the window only slides forward
+                task.successes += ok;
+                while (task.invocations[task.first].first <= instant - window) {
+                    task.successes -= task.invocations[task.first].second;
+                    ++task.first;
+                }
+                count = task.invocations.size() - task.first;
+                successes = task.successes;
+            } else {
+                for (const std::pair<int64_t, int> &invocation : task.invocations) {
+                    if (invocation.first > instant - window && invocation.first <= instant) {
+                        ++count;
+                        successes += invocation.second;
+                    }
+                }
+            }
+            // a single status does not make a reliability yet
+            task.reliability = task.invocations.size() > 1 ? static_cast<double>(successes) / count : 0;
+
+            if (!reliability) return;
+            if (task.reliability_term) *task.reliability_term = task.reliability;
+            for (Task *t : task_order) {
+                if (!t->frequency_term) {
+                    for (const std::pair<const std::string, Task> &entry : tasks) {
+                        if (&entry.second == t) t->frequency_term = term("F_" + entry.first);
+                    }
+                }
+                if (t->frequency_term) *t->frequency_term = 1;
+            }
+        }
+
+        void LogAnalyzer::event(const StringView &source, const StringView &content) {
+            if (!reliability) return;
+
+            std::string name = tag(source);
+            double *ctx = term("CTX_" + name);
+            if (!ctx) return;
+
+            if (contexts.insert(name).second) *ctx = 1;
+            if (content == "deactivate") {
+                *ctx = 0;
+            } else if (content == "activate") {
+                *ctx = 1;
+            }
+        }
+
+        double LogAnalyzer::evaluate() {
+            for (const std::pair<double *, double> &term : ignored) {
+                *term.first = term.second;
+            }
+            return expression.evaluate();
+        }
+
+        void LogAnalyzer::point(const int64_t &instant, const double &value) {
+            // one value per instant, the last one, where the instant first appeared
+            std::map<int64_t, size_t>::iterator it = curve_index.find(instant);
+            if (it != curve_index.end()) {
+                curve[it->second].second = value;
+            } else {
+                curve_index[instant] = curve.size();
+                curve.push_back(std::make_pair(instant, value));
+            }
+        }
+
+        const std::vector<std::pair<int64_t, double>> &LogAnalyzer::getCurve() const {
+            return curve;
+        }
+
+        ControlMetrics LogAnalyzer::analyze() const {
+            std::vector<int64_t> x;
+            std::vector<double> y;
+            for (const std::pair<int64_t, double> &p : curve) {
+                if (p.first >= triggered) {
+                    x.push_back(p.first);
+                    y.push_back(p.second);
+                }
+            }
+            if (x.empty()) throw std::runtime_error("nothing to analyze after the first adaptation");
+
+            ControlMetrics metrics;
+
+            // over the last quarter of the curve, summed with compensation as
+            // statistics.mean sums exactly
+            double sum = 0, compensation = 0;
+            size_t from = 3 * x.size() / 4;
+            for (size_t i = from; i < y.size(); ++i) {
+                double t = sum + y[i];
+                compensation += std::fabs(sum) >= std::fabs(y[i]) ? (sum - t) + y[i] : (y[i] - t) + sum;
+                sum = t;
+            }
+            metrics.mean = (sum + compensation) / (y.size() - from);
+
+            // the curve settles where it last enters the band around the mean and
+            // stays there; if it never leaves it, the script finds no settling point
+            double lower = metrics.mean * (1 - stability_margin);
+            double upper = metrics.mean * (1 + stability_margin);
+            size_t stability_point = 0;
+            bool inside = false;
+            for (size_t i = 0; i < y.size(); ++i) {
+                if (lower <= y[i] && y[i] <= upper) {
+                    if (!inside) {
+                        stability_point = i;
+                        inside = true;
+                    }
+                } else {
+                    stability_point = 0;
+                    inside = false;
+                }
+            }
+            metrics.stable = stability_point != 0;
+            metrics.settling_time = static_cast<double>(x[stability_point] - x[0]) / 1e9;
+
+            metrics.overshoot = 100 * (*std::max_element(y.begin(), y.end()) - metrics.mean) / metrics.mean;
+            metrics.sse = 100 * (std::fabs(setpoint - metrics.mean) / setpoint);
+
+            double error = 0;
+            for (double v : y) error += std::fabs(setpoint - v);
+            metrics.robustness = 100 * (1 - error / x.size());
+
+            return metrics;
+        }
+    }
+}
@@ -0,0 +1,135 @@
+#include "libbsn/configuration/RiskTable.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+using namespace std;
+using namespace bsn::range;
+
+namespace bsn {
+	namespace configuration {
+
+		namespace {
+			// one range of the configuration and its map into percentage space
+			struct Segment {
+				Range range;
+				RiskTable::Level level;
+				double origin;
+				double span;
+				Range percentage;
+			};
+
+			// the displacements of SensorConfiguration::getDisplacement
+			Segment medium(const Range &r, const Range &p) {
+				double mid = (r.getUpperBound() + r.getLowerBound())/2.0;
+				Segment s = {r, RiskTable::LOW, mid, r.getUpperBound() - mid, p};
+				return s;
+			}
+
+			Segment decrescent(const Range &r, const RiskTable::Level &level, const Range &p) {
+				Segment s = {r, level, r.getUpperBound(), r.getUpperBound() - r.getLowerBound(), p};
+				return s;
+			}
+
+			Segment crescent(const Range &r, const RiskTable::Level &level, const Range &p) {
+				Segment s = {r, level, r.getLowerBound(), r.getUpperBound() - r.getLowerBound(), p};
+				return s;
+			}
+		}
+
+		RiskTable::RiskTable() : bounds(), levels(), origin(), span(), width(), lower() {
+			bounds.fill(numeric_limits<double>::infinity());
+			levels.fill(UNKNOWN);
+			span.fill(1);
+		}
+
+		RiskTable::RiskTable(const Range &low, const array<Range, 2> &mid, const array<Range, 2> &high, const array<Range, 3> &p) :
+			bounds(), levels(), origin(), span(), width(), lower() {
+
+			bounds.fill(numeric_limits<double>::infinity());
+			levels.fill(UNKNOWN);
+			span.fill(1);
+
+			// in the order evaluateNumber tries them
+			const Segment segments[] = {
+				medium(low, p[0]),
+				decrescent(mid[0], MEDIUM, p[1]),
+				crescent(mid[1], MEDIUM, p[1]),
+				decrescent(high[0], HIGH, p[2]),
+				crescent(high[1], HIGH, p[2])};
+
+			vector<double> points;
+			for (const Segment &s : segments) {
+				points.push_back(s.range.getLowerBound());
+				points.push_back(s.range.getUpperBound());
+			}
+			sort(points.begin(), points.end());
+			points.erase(unique(points.begin(), points.end()), points.end());
+			copy(points.begin(), points.end(), bounds.begin());
+
+			// cell 2k is the interval below bounds[k], cell 2k+1 is bounds[k] itself;
+			// the cells below the first and above the last bound stay unknown
+			for (size_t cell = 1; cell < 2 * points.size(); ++cell) {
+				size_t k = cell / 2;
+				double sample = (cell % 2) ? points[k] : (points[k-1] + points[k]) / 2;
+
+				for (const Segment &s : segments) {
+					Range r = s.range;
+					if (!r.in_range(sample)) continue;
+
+					levels[cell] = s.level;
+					origin[cell] = s.origin;
+					span[cell] = s.span;
+					width[cell] = s.percentage.getUpperBound() - s.percentage.getLowerBound();
+					lower[cell] = s.percentage.getLowerBound();
+					break;
+				}
+			}
+		}
+
+		RiskTable::RiskTable(const RiskTable &obj) :
+			bounds(obj.bounds),
+			levels(obj.levels),
+			origin(obj.origin),
+			span(obj.span),
+			width(obj.width),
+			lower(obj.lower) {}
+
+		RiskTable& RiskTable::operator=(const RiskTable &obj) {
+			bounds = obj.bounds;
+			levels = obj.levels;
+			origin = obj.origin;
+			span = obj.span;
+			width = obj.width;
+			lower = obj.lower;
+			return (*this);
+		}
+
+		size_t RiskTable::locate(const double &value) const {
+			size_t below = 0;
+			for (size_t i = 0; i < max_bounds; ++i) {
+				below += (bounds[i] < value);
+			}
+			return 2 * below + (bounds[below] == value);
+		}
+
+		RiskTable::Level RiskTable::classify(const double &value) const {
+			return static_cast<Level>(levels[locate(value)]);
+		}
+
+		double RiskTable::evaluate(const double &value) const {
+			size_t cell = locate(value);
+			double risk = fabs(value - origin[cell]) / span[cell] * width[cell] + lower[cell];
+			return (levels[cell] == UNKNOWN) ? -1 : risk;
+		}
+
+		void RiskTable::evaluate(const double *values, double *risks, const size_t &n) const {
+			for (size_t i = 0; i < n; ++i) {
+				risks[i] = evaluate(values[i]);
+			}
+		}
+
+	}
+}
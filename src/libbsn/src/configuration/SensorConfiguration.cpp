@@ -12,7 +12,8 @@ namespace bsn {
 			highRisk(),
 			lowPercentage(),
 			midPercentage(),
-			highPercentage() {}
+			highPercentage(),
+			table() {}
 
 		SensorConfiguration::SensorConfiguration(int32_t i, Range l, 
 			array<Range, 2> m, array<Range, 2> h, array<Range, 3> p) : 
@@ -22,7 +23,10 @@ namespace bsn {
 			highRisk(h),
 			lowPercentage(p[0]),
 			midPercentage(p[1]),
-			highPercentage(p[2]) {}
+			highPercentage(p[2]),
+			table() {
+			compile();
+		}
 
 		SensorConfiguration::SensorConfiguration(const SensorConfiguration &obj) : 
 			id(obj.getId()),
@@ -31,7 +35,8 @@ namespace bsn {
 			highRisk(obj.getHighRisk()),
 			lowPercentage(obj.getLowPercentage()),
 			midPercentage(obj.getMidPercentage()),
-			highPercentage(obj.getHighPercentage()) {}
+			highPercentage(obj.getHighPercentage()),
+			table(obj.table) {}
 
 		SensorConfiguration& SensorConfiguration::operator=(const SensorConfiguration &obj) {
             id = obj.getId();
@@ -40,7 +45,8 @@ namespace bsn {
 			highRisk = obj.getHighRisk();
 			lowPercentage = obj.getLowPercentage();
 			midPercentage = obj.getMidPercentage();
-			highPercentage = obj.getHighPercentage();        
+			highPercentage = obj.getHighPercentage();
+			table = obj.table;
             return (*this);
         }
 
@@ -91,37 +97,28 @@ namespace bsn {
 			return oldRange.convert(lb,ub,number);
 		}
 
-		double SensorConfiguration::evaluateNumber(double number) {
-			double displacement;
-			Range per_cent(0,100);
-
-			if(lowRisk.in_range(number)) {				
-				displacement = getDisplacement(lowRisk, number, "medium");
-				return convertRealPercentage(lowPercentage, displacement);
-			}	
-
-			else if(mediumRisk[0].in_range(number)) {
-				displacement = getDisplacement(mediumRisk[0], number, "decrescent");	
-				return convertRealPercentage(midPercentage, displacement);	
-			}
+		void SensorConfiguration::compile() {
+			array<Range, 3> percentages = {{lowPercentage, midPercentage, highPercentage}};
+			table = RiskTable(lowRisk, mediumRisk, highRisk, percentages);
+		}
 
-			else if(mediumRisk[1].in_range(number)) {
-				displacement = getDisplacement(mediumRisk[1], number);
-				return convertRealPercentage(midPercentage, displacement);	
-			}
+		// Same result as trying lowRisk, mediumRisk[0], mediumRisk[1], highRisk[0] and
+		// highRisk[1] in turn, with the displacement of getDisplacement for each one
+		double SensorConfiguration::evaluateNumber(double number) const {
+			return table.evaluate(number);
+		}
 
-			else if(highRisk[0].in_range(number)) {
-				displacement = getDisplacement(highRisk[0], number, "decrescent");
-				return convertRealPercentage(highPercentage, displacement);			
-			}
+		void SensorConfiguration::evaluateNumbers(const double *numbers, double *risks, const size_t &n) const {
+			table.evaluate(numbers, risks, n);
+		}
 
-			else if(highRisk[1].in_range(number)) {
-				displacement = getDisplacement(highRisk[1], number);		
-				return convertRealPercentage(highPercentage, displacement);	
+		string SensorConfiguration::label(double val) const {
+			switch (table.classify(val)) {
+				case RiskTable::LOW: return "low";
+				case RiskTable::MEDIUM: return "moderate";
+				case RiskTable::HIGH: return "high";
+				default: return "unknown";
 			}
-			else {
-				return -1;
-			}	
 		}
 
 		const string SensorConfiguration::toString() {
@@ -144,6 +141,7 @@ namespace bsn {
 
 		void SensorConfiguration::setLowRisk(const Range l) {
 			lowRisk = l;
+			compile();
 		}
 
 		array<Range, 2> SensorConfiguration::getMediumRisk() const {
@@ -152,6 +150,7 @@ namespace bsn {
 
 		void SensorConfiguration::setMediumRisk(const array<Range, 2> m) {
 			mediumRisk = m;
+			compile();
 		}
 
 		array<Range, 2> SensorConfiguration::getHighRisk() const {
@@ -172,6 +171,7 @@ namespace bsn {
 
 		void SensorConfiguration::setHighRisk(const array<Range, 2> h) {
 			highRisk = h;
+			compile();
 		}
 
 		Range SensorConfiguration::getLowPercentage() const {
@@ -180,6 +180,7 @@ namespace bsn {
 
 		void SensorConfiguration::setLowPercentage(const Range lp) {
 			lowPercentage = lp;
+			compile();
 		}
 
 		Range SensorConfiguration::getMidPercentage() const {
@@ -188,6 +189,7 @@ namespace bsn {
 
 		void SensorConfiguration::setMidPercentage(const Range mp) {
 			midPercentage = mp;
+			compile();
 		}
 
 		Range SensorConfiguration::getHighPercentage() const {
@@ -196,6 +198,7 @@ namespace bsn {
 
 		void SensorConfiguration::setHighPercentage(const Range hp) {
 			highPercentage = hp;
+			compile();
 		}
 
 	}
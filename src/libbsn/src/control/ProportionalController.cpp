@@ -0,0 +1,71 @@
+#include "libbsn/control/ProportionalController.hpp"
+
+#include <cmath>
+
+namespace bsn {
+    namespace control {
+
+        ProportionalController::ProportionalController(const double &min_freq, const double &max_freq, const double &stability_margin) :
+            min_freq(min_freq),
+            max_freq(max_freq),
+            stability_margin(stability_margin) {}
+
+        ProportionalController::~ProportionalController() {}
+
+        ProportionalController::ProportionalController(const ProportionalController &obj) :
+            min_freq(obj.min_freq),
+            max_freq(obj.max_freq),
+            stability_margin(obj.stability_margin) {}
+
+        ProportionalController &ProportionalController::operator=(const ProportionalController &obj) {
+            min_freq = obj.min_freq;
+            max_freq = obj.max_freq;
+            stability_margin = obj.stability_margin;
+            return *this;
+        }
+
+        ControlAction ProportionalController::step(const bool &hub, const bool &replicate_collect, const double &ref, const double &curr, const double &kp,
+                                                   double &freq, int &replicate, int &exception_buffer) const {
+            ControlAction action;
+            double error = ref - curr;
+
+            if (error > stability_margin*ref || error < stability_margin*ref) {
+                exception_buffer = (exception_buffer < 0) ? 0 : exception_buffer + 1;
+
+                if (hub) {
+                    // g4t1 reliability is inversely proportional to the sensors frequency
+                    double new_freq = freq + ((kp/100) * error);
+                    if (new_freq > 0) {
+                        freq = new_freq;
+                        action.command = ControlAction::FREQ;
+                        action.value = freq;
+                    }
+                } else if (replicate_collect) {
+                    replicate += (error > 0) ? std::ceil(kp * error) : std::floor(kp * error);
+                    if (replicate < 1) replicate = 1;
+                    action.command = ControlAction::REPLICATE_COLLECT;
+                    action.value = replicate;
+                } else {
+                    double new_freq = freq + ((kp/100) * error);
+                    if (new_freq >= min_freq && new_freq <= max_freq) {
+                        freq = new_freq;
+                        action.command = ControlAction::FREQ;
+                        action.value = freq;
+                    }
+                }
+            } else {
+                exception_buffer = (exception_buffer > 0) ? 0 : exception_buffer - 1;
+            }
+
+            if (exception_buffer > 4) {
+                action.exception = 1;
+                exception_buffer = 0;
+            } else if (exception_buffer < -4) {
+                action.exception = -1;
+                exception_buffer = 0;
+            }
+
+            return action;
+        }
+    }
+}
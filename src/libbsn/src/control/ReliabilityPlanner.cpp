@@ -0,0 +1,142 @@
+#include "libbsn/control/ReliabilityPlanner.hpp"
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace bsn {
+    namespace control {
+
+        namespace {
+            double evaluate(bsn::model::Formula &model, const std::map<std::string, double> &strategy) {
+                model.setTermValueMap(strategy);
+                return model.evaluate();
+            }
+
+            bool deactivated(const std::map<std::string, int> &components, const std::string &term) {
+                std::map<std::string, int>::const_iterator it = components.find(term);
+                return it != components.end() && it->second != 0;
+            }
+
+            // by priority, then by name
+            struct comp {
+                template<typename T>
+                bool operator()(const T& l, const T& r) const {
+                    if (l.second != r.second) return l.second < r.second;
+                    return l.first < r.first;
+                }
+            };
+        }
+
+        ReliabilityPlanner::ReliabilityPlanner(const double &setpoint, const double &offset, const double &gain, const double &tolerance) :
+            setpoint(setpoint),
+            offset(offset),
+            gain(gain),
+            tolerance(tolerance) {}
+
+        ReliabilityPlanner::~ReliabilityPlanner() {}
+
+        ReliabilityPlanner::ReliabilityPlanner(const ReliabilityPlanner &obj) :
+            setpoint(obj.setpoint),
+            offset(obj.offset),
+            gain(obj.gain),
+            tolerance(obj.tolerance) {}
+
+        ReliabilityPlanner &ReliabilityPlanner::operator=(const ReliabilityPlanner &obj) {
+            setpoint = obj.setpoint;
+            offset = obj.offset;
+            gain = obj.gain;
+            tolerance = obj.tolerance;
+            return *this;
+        }
+
+        bool ReliabilityPlanner::off(const double &reliability) const {
+            double error = setpoint - reliability;
+            return (error > setpoint * tolerance) || (error < -tolerance * setpoint);
+        }
+
+        bool ReliabilityPlanner::plan(bsn::model::Formula model, std::map<std::string, double> &strategy,
+                                      const std::map<std::string, int> &priority, const std::map<std::string, int> &deactivatedComponents) const {
+            double r_curr = evaluate(model, strategy);
+            double error = setpoint - r_curr;
+            // already there, no step would move it
+            if (error == 0) return true;
+
+            std::vector<std::string> aux;
+            for (std::map<std::string, double>::iterator it = strategy.begin(); it != strategy.end(); ++it) {
+                if (it->first.find("R_") != std::string::npos) {
+                    std::string task = it->first;
+                    task.erase(0, 2);
+                    if (strategy["CTX_" + task] != 0 && strategy["F_" + task] != 0) { // avoid ctx = 0 components thus infinite loops
+                        if (!deactivated(deactivatedComponents, it->first)) {
+                            aux.push_back(it->first);
+                            it->second = r_curr;
+                        } else {
+                            it->second = 1;
+                        }
+                    }
+                }
+            }
+
+            // reorder by priority
+            std::vector<std::string> r_vec;
+            std::set<std::pair<std::string, int>, comp> set(priority.begin(), priority.end());
+            for (auto const &pair : set) {
+                if (std::find(aux.begin(), aux.end(), pair.first) != aux.end()) r_vec.push_back(pair.first);
+            }
+
+            std::vector<std::map<std::string, double>> solutions;
+            for (std::vector<std::string>::iterator i = r_vec.begin(); i != r_vec.end(); ++i) {
+                // reset offset
+                for (std::vector<std::string>::iterator it = r_vec.begin(); it != r_vec.end(); ++it) {
+                    if (error > 0) {
+                        strategy[*it] = r_curr*(1-offset);
+                    } else {
+                        strategy[*it] = (r_curr*(1+offset) > 1) ? 1 : r_curr*(1+offset);
+                    }
+                }
+                double r_new = evaluate(model, strategy);
+
+                // the prioritized component first, then all the others
+                std::vector<std::string> order(1, *i);
+                for (std::vector<std::string>::iterator j = r_vec.begin(); j != r_vec.end(); ++j) {
+                    if (*j != *i) order.push_back(*j);
+                }
+
+                std::map<std::string, double> prev;
+                double r_prev = 0;
+                for (const std::string &j : order) {
+                    do {
+                        prev = strategy;
+                        r_prev = r_new;
+                        strategy[j] += gain*error;
+                        r_new = evaluate(model, strategy);
+                    } while (((error > 0) ? (r_new < setpoint && r_prev < r_new) : (r_new > setpoint && r_prev > r_new)) && strategy[j] > 0 && strategy[j] < 1);
+
+                    strategy = prev;
+                    r_new = evaluate(model, strategy);
+                }
+                solutions.push_back(strategy);
+            }
+
+            for (std::vector<std::map<std::string, double>>::iterator it = solutions.begin(); it != solutions.end(); ++it) {
+                strategy = *it;
+                double r_new = evaluate(model, strategy);
+                if (r_new > setpoint*(1-tolerance) && r_new < setpoint*(1+tolerance)) return true;
+            }
+
+            return false;
+        }
+
+        bool prioritize(std::map<std::string, int> &priority, const std::string &term, const int &change) {
+            std::map<std::string, int>::iterator it = priority.find(term);
+            if (it == priority.end()) return false;
+
+            it->second += change;
+            if (it->second > 99) it->second = 100;
+            if (it->second < 1) it->second = 0;
+            return true;
+        }
+    }
+}
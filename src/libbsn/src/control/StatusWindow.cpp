@@ -0,0 +1,46 @@
+#include "libbsn/control/StatusWindow.hpp"
+
+#include <stdint.h>
+
+namespace bsn {
+    namespace control {
+
+        StatusWindow::StatusWindow(const double &span) : span(span), statuses() {}
+
+        StatusWindow::~StatusWindow() {}
+
+        StatusWindow::StatusWindow(const StatusWindow &obj) : span(obj.span), statuses(obj.statuses) {}
+
+        StatusWindow &StatusWindow::operator=(const StatusWindow &obj) {
+            span = obj.span;
+            statuses = obj.statuses;
+            return *this;
+        }
+
+        void StatusWindow::push(const double &time, const std::string &status) {
+            statuses.push_back(std::make_pair(time, status));
+        }
+
+        void StatusWindow::slide(const double &now) {
+            while (!statuses.empty() && now - statuses.front().first >= span) statuses.pop_front();
+        }
+
+        double StatusWindow::reliability() const {
+            double sum = 0;
+            uint32_t len = 0;
+            for (const std::pair<double, std::string> &status : statuses) {
+                if (status.second == "success") {
+                    sum += 1;
+                    len++;
+                } else if (status.second == "fail") {
+                    len++;
+                }
+            }
+            return (len > 0) ? sum / len : 0;
+        }
+
+        const std::deque<std::pair<double, std::string>> &StatusWindow::getStatuses() const {
+            return statuses;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include "libbsn/filters/ExponentialMovingAverage.hpp"
+
+using namespace std;
+
+namespace bsn {
+    namespace filters {
+
+        ExponentialMovingAverage::ExponentialMovingAverage(int32_t max) : computedAverage(0.0), range(), alpha(), empty(true) {
+            setRange(max > 0 ? max : 1);
+        }
+
+        ExponentialMovingAverage::ExponentialMovingAverage(const ExponentialMovingAverage &obj) :
+            computedAverage(obj.computedAverage),
+            range(obj.range),
+            alpha(obj.alpha),
+            empty(obj.empty) {}
+
+        ExponentialMovingAverage& ExponentialMovingAverage::operator=(const ExponentialMovingAverage &obj) {
+            computedAverage = obj.computedAverage;
+            range = obj.range;
+            alpha = obj.alpha;
+            empty = obj.empty;
+            return (*this);
+        }
+
+        ExponentialMovingAverage *ExponentialMovingAverage::clone() const {
+            return new ExponentialMovingAverage(*this);
+        }
+
+        double ExponentialMovingAverage::getValue() {
+            return computedAverage;
+        }
+
+        void ExponentialMovingAverage::insert(double value) {
+            // the first sample seeds the average
+            if (empty) {
+                computedAverage = value;
+                empty = false;
+            } else {
+                computedAverage += alpha * (value - computedAverage);
+            }
+        }
+
+        uint32_t ExponentialMovingAverage::getRange() const {
+            return range;
+        }
+
+        void ExponentialMovingAverage::setRange(const uint32_t r) {
+            range = (r > 0) ? r : 1;
+            alpha = 2.0 / (range + 1);
+        }
+
+        double ExponentialMovingAverage::getAlpha() const {
+            return alpha;
+        }
+
+        const string ExponentialMovingAverage::toString() const {
+            stringstream sstr;
+
+            sstr << "Computed average:" << computedAverage << "" << endl;
+
+            return sstr.str();
+        }
+
+    }
+}
@@ -0,0 +1,22 @@
+#include "libbsn/filters/Filter.hpp"
+#include "libbsn/filters/MovingAverage.hpp"
+#include "libbsn/filters/ExponentialMovingAverage.hpp"
+#include "libbsn/filters/MovingMedian.hpp"
+
+namespace bsn {
+    namespace filters {
+
+        std::unique_ptr<Filter> make_filter(const std::string &type, const uint32_t &range) {
+            if (type == "moving_average") {
+                return std::unique_ptr<Filter>(new MovingAverage(range));
+            } else if (type == "exponential") {
+                return std::unique_ptr<Filter>(new ExponentialMovingAverage(range));
+            } else if (type == "median") {
+                return std::unique_ptr<Filter>(new MovingMedian(range));
+            }
+
+            throw std::invalid_argument("unknown filter type " + type);
+        }
+
+    }
+}
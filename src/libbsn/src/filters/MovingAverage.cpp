@@ -1,65 +1,106 @@
 #include "libbsn/filters/MovingAverage.hpp"
 #include <iostream>
+#include <cmath>
 
 using namespace std;
 
 namespace bsn {
     namespace filters{
+
+        MovingAverage::MovingAverage() : computedAverage(0.0), lastInserted(0.0), range(1), buffer(1), head(0), count(0), sum(0.0), compensation(0.0) {}
         
-        MovingAverage::MovingAverage(int32_t max) : computedAverage(0.0), lastInserted(0.0), range(max), buffer({}) {}
+        MovingAverage::MovingAverage(int32_t max) : computedAverage(0.0), lastInserted(0.0), range(max > 0 ? max : 0), buffer(range), head(0), count(0), sum(0.0), compensation(0.0) {}
 
         MovingAverage::MovingAverage(const MovingAverage &obj) :
-            computedAverage(0),
-            lastInserted(0),
-            range(obj.getRange()),
-            buffer({}) {}
+            computedAverage(obj.computedAverage),
+            lastInserted(obj.lastInserted),
+            range(obj.range),
+            buffer(obj.buffer),
+            head(obj.head),
+            count(obj.count),
+            sum(obj.sum),
+            compensation(obj.compensation) {}
         
         MovingAverage& MovingAverage::operator=(const MovingAverage &obj) {
-            range = obj.getRange();          
+            computedAverage = obj.computedAverage;
+            lastInserted = obj.lastInserted;
+            range = obj.range;
+            buffer = obj.buffer;
+            head = obj.head;
+            count = obj.count;
+            sum = obj.sum;
+            compensation = obj.compensation;
             return (*this);
         }
 
-        double MovingAverage::getValue() {
-     
-            computedAverage = 0.0;
-
-            // Se a lista ainda não foi preenchida
-            if(buffer.size() < range && buffer.size() > 0){
-                for(double i : buffer) {
-                    computedAverage += i;
-                    }
-                computedAverage /= buffer.size();
-                return computedAverage;
-            }
-            // Quando a lista possui o limite máximo de valores
-            else if(buffer.size() == range) {
-                for(double i : buffer) {
-                    computedAverage += i;
-                    }
-                computedAverage /= range;
-                return computedAverage;
+        MovingAverage *MovingAverage::clone() const {
+            return new MovingAverage(*this);
+        }
+
+        // compensated (Kahan-Babuska) summation
+        void MovingAverage::add(const double &value) {
+            double t = sum + value;
+            if (std::fabs(sum) >= std::fabs(value)) {
+                compensation += (sum - t) + value;
+            } else {
+                compensation += (value - t) + sum;
             }
-			// Qualquer outro range de valores
-            return 0;
+            sum = t;
+        }
+
+        double MovingAverage::getValue() {
+            // nothing in the window yet
+            if (count == 0) return 0;
 
+            computedAverage = (sum + compensation) / count;
+            return computedAverage;
         }
 
         void MovingAverage::insert(double value) {            
-            lastInserted = value;   
-            buffer.push_back(lastInserted);
-
-            if(buffer.size() > range) {
-                buffer.pop_front();
+            lastInserted = value;
+            if (range == 0) return;
+
+            // the window is full, the oldest sample leaves the sum
+            if (count == range) {
+                add(-buffer[head]);
+            } else {
+                ++count;
             }
 
+            buffer[head] = value;
+            add(value);
+            head = (head + 1) % range;
+
+            // once per lap of the ring, the sum is recomputed from the window itself
+            // so that no rounding error outlives the samples it came from (O(1) amortized)
+            if (head == 0) {
+                sum = 0.0;
+                compensation = 0.0;
+                for (uint32_t i = 0; i < count; ++i) add(buffer[i]);
+            }
         }
 
         uint32_t MovingAverage::getRange() const {
             return range;
         }
 
+        // keeps the newest samples that fit in the new range
         void MovingAverage::setRange(const uint32_t r) {
+            std::vector<double> samples = getBuffer();
+            double last = lastInserted;
+            size_t first = (samples.size() > r) ? samples.size() - r : 0;
+
             range = r;
+            buffer.assign(range, 0.0);
+            head = 0;
+            count = 0;
+            sum = 0.0;
+            compensation = 0.0;
+
+            for (size_t i = first; i < samples.size(); ++i) {
+                insert(samples[i]);
+            }
+            lastInserted = last;
         }
 
         const string MovingAverage::toString() const {
@@ -70,10 +111,17 @@ namespace bsn {
             return sstr.str();
         }
 
-        std::list<double> MovingAverage::getBuffer(){
+        std::vector<double> MovingAverage::getBuffer() const {
+            std::vector<double> samples;
+            samples.reserve(count);
+
+            uint32_t oldest = (count == range) ? head : 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                samples.push_back(buffer[(oldest + i) % range]);
+            }
 
-            return buffer;
+            return samples;
         }
 
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,124 @@
+#include "libbsn/filters/MovingMedian.hpp"
+
+#include <cmath>
+#include <iterator>
+
+using namespace std;
+
+namespace bsn {
+    namespace filters {
+
+        MovingMedian::MovingMedian(int32_t max) : computedMedian(0.0), range(max > 0 ? max : 0), buffer(range), head(0), count(0), lower(), upper() {}
+
+        MovingMedian::MovingMedian(const MovingMedian &obj) :
+            computedMedian(obj.computedMedian),
+            range(obj.range),
+            buffer(obj.buffer),
+            head(obj.head),
+            count(obj.count),
+            lower(obj.lower),
+            upper(obj.upper) {}
+
+        MovingMedian& MovingMedian::operator=(const MovingMedian &obj) {
+            computedMedian = obj.computedMedian;
+            range = obj.range;
+            buffer = obj.buffer;
+            head = obj.head;
+            count = obj.count;
+            lower = obj.lower;
+            upper = obj.upper;
+            return (*this);
+        }
+
+        MovingMedian *MovingMedian::clone() const {
+            return new MovingMedian(*this);
+        }
+
+        double MovingMedian::getValue() {
+            if (count == 0) return 0;
+
+            if (lower.size() > upper.size()) {
+                computedMedian = *lower.rbegin();
+            } else {
+                computedMedian = (*lower.rbegin() + *upper.begin()) / 2;
+            }
+
+            return computedMedian;
+        }
+
+        void MovingMedian::insert(double value) {
+            // NaN is not ordered, it could not be found again to be erased
+            if (range == 0 || std::isnan(value)) return;
+
+            if (count == range) {
+                erase(buffer[head]);
+            } else {
+                ++count;
+            }
+            buffer[head] = value;
+            head = (head + 1) % range;
+
+            if (lower.empty() || value <= *lower.rbegin()) {
+                lower.insert(value);
+            } else {
+                upper.insert(value);
+            }
+            balance();
+        }
+
+        void MovingMedian::erase(const double &value) {
+            std::multiset<double>::iterator it = lower.find(value);
+            if (it != lower.end()) {
+                lower.erase(it);
+            } else {
+                upper.erase(upper.find(value));
+            }
+        }
+
+        // lower holds as many samples as upper, or one more
+        void MovingMedian::balance() {
+            while (lower.size() > upper.size() + 1) {
+                upper.insert(*lower.rbegin());
+                lower.erase(std::prev(lower.end()));
+            }
+            while (upper.size() > lower.size()) {
+                lower.insert(*upper.begin());
+                upper.erase(upper.begin());
+            }
+        }
+
+        uint32_t MovingMedian::getRange() const {
+            return range;
+        }
+
+        // keeps the newest samples that fit in the new range
+        void MovingMedian::setRange(const uint32_t r) {
+            std::vector<double> samples;
+            uint32_t oldest = (count == range) ? head : 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                samples.push_back(buffer[(oldest + i) % range]);
+            }
+            size_t first = (samples.size() > r) ? samples.size() - r : 0;
+
+            range = r;
+            buffer.assign(range, 0.0);
+            head = 0;
+            count = 0;
+            lower.clear();
+            upper.clear();
+
+            for (size_t i = first; i < samples.size(); ++i) {
+                insert(samples[i]);
+            }
+        }
+
+        const string MovingMedian::toString() const {
+            stringstream sstr;
+
+            sstr << "Computed median:" << computedMedian << "" << endl;
+
+            return sstr.str();
+        }
+
+    }
+}
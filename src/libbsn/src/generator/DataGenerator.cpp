@@ -1,66 +1,76 @@
 #include "libbsn/generator/DataGenerator.hpp"
 #include "libbsn/range/Range.hpp"
+#include "libbsn/random/Seed.hpp"
+
+#include <algorithm>
+#include <stdexcept>
 
 namespace bsn {
     namespace generator {
-        DataGenerator::DataGenerator() : markovChain(), seed() {}
+        DataGenerator::DataGenerator() : markovChain(), rng() {}
 
         DataGenerator::DataGenerator(const Markov& markov) : 
             markovChain(markov),
-            seed() {}
+            rng() {}
 
         DataGenerator::DataGenerator(const DataGenerator& obj) :
             markovChain(obj.markovChain),
-            seed() {}
+            rng(obj.rng) {}
 
         DataGenerator::~DataGenerator() {}
 
         DataGenerator& DataGenerator::operator=(const DataGenerator& obj) {
             markovChain = obj.markovChain;
+            rng = obj.rng;
             return (*this);
         }
 
-        std::uniform_int_distribution<int> probabilityGenerator(1,100);
-
-
         void DataGenerator::setSeed() {
-            std::random_device rd;
-            std::mt19937 aux(rd());
-            seed = aux;
+            rng.seed(bsn::random::random_seed());
+        }
+
+        void DataGenerator::setSeed(const uint64_t &seed) {
+            rng.seed(seed);
         }
 
         void DataGenerator::nextState() {
-            int32_t randomNumber = probabilityGenerator(seed);
-            // Calcula o offset do vetor baseado no estado
-            int32_t offset = markovChain.currentState * 5;
-            
-            if (randomNumber <= markovChain.transitions[offset]) {
-                markovChain.currentState = 0;                        
-            }    
-            else if (randomNumber <= markovChain.transitions[offset + 1]) {
-                markovChain.currentState = 1;             
-            }    
-            else if (randomNumber <= markovChain.transitions[offset + 2]) {
-                markovChain.currentState = 2;
-            }     
-            else if (randomNumber <= markovChain.transitions[offset + 3]) {
-                markovChain.currentState = 3;        
-            }    
-            else if (randomNumber <= markovChain.transitions[offset + 4]) {
-                markovChain.currentState = 4;
-            }
+            markovChain.next_state(rng.uniform());
         }
 
         double DataGenerator::calculateValue() {
-            if (markovChain.currentState > 4 || markovChain.currentState < 0){
-                throw std::out_of_range("current state is out of bounds");
-            }
-
-            bsn::range::Range range = markovChain.states[markovChain.currentState];
             // Cria um número aleatório baseado no range
-            std::uniform_real_distribution<double> value_generator(range.getLowerBound(), range.getUpperBound());
-            double val = value_generator(seed);
-            return val;
+            return markovChain.calculate_state(rng.uniform());
+        }
+
+        void DataGenerator::generate(const size_t &n, double *out, const size_t &period) {
+            if (period == 0) throw std::invalid_argument("period must be positive");
+
+            // one draw per transition and one per value, in the order of the sequential calls
+            size_t draws = n + (n + period - 1) / period;
+            double u[256];
+            size_t available = 0, next = 0;
+
+            auto refill = [&]() {
+                if (next < available) return;
+                available = std::min(draws, sizeof(u) / sizeof(u[0]));
+                rng.fill(u, available);
+                draws -= available;
+                next = 0;
+            };
+
+            for (size_t i = 0; i < n; ) {
+                if (i % period == 0) {
+                    refill();
+                    markovChain.next_state(u[next++]);
+                }
+                refill();
+
+                // the rest of the period that is already drawn, all in the same state
+                size_t m = std::min(std::min(period - i % period, n - i), available - next);
+                markovChain.calculate_states(m, u + next, out + i);
+                next += m;
+                i += m;
+            }
         }
 
         double DataGenerator::getValue() {
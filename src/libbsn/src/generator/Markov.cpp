@@ -1,34 +1,187 @@
 #include "libbsn/generator/Markov.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 using namespace std;
 using namespace bsn::range;
 
 namespace bsn {
     namespace generator {
-        Markov::Markov() : transitions(), currentState(), states() {}
+        Markov::Markov() : transitions(), states(), currentState(), probability(), alias(), lower(), width() {}
 
         // Construtor
-        Markov::Markov(array<float,25> t, array<Range, 5> r, int32_t initialState) :
+        Markov::Markov(const vector<double> &t, const vector<Range> &r, const int32_t &initialState) :
             transitions(t),
+            states(r),
             currentState(initialState),
-            states(r) {}
+            probability(),
+            alias(),
+            lower(),
+            width() {
+
+            if (transitions.size() != states.size() * states.size()) {
+                throw invalid_argument("transition matrix must be " + to_string(states.size()) + "x" + to_string(states.size()));
+            }
+
+            build();
+        }
 
         Markov::Markov(const Markov &obj) :
             transitions(obj.transitions),
+            states(obj.states),
             currentState(obj.currentState),
-            states(obj.states) {}
-        
+            probability(obj.probability),
+            alias(obj.alias),
+            lower(obj.lower),
+            width(obj.width) {}
+
         Markov& Markov::operator=(const Markov &obj) {
             transitions = obj.transitions;
-            currentState = obj.currentState;
             states = obj.states;
+            currentState = obj.currentState;
+            probability = obj.probability;
+            alias = obj.alias;
+            lower = obj.lower;
+            width = obj.width;
             return (*this);
         }
 
+        /*
+         * Vose's alias method: every column k of a row keeps its own
+         * outcome with probability[k] and hands the rest over to alias[k].
+         */
+        void Markov::build() {
+            const size_t n = states.size();
+
+            probability.assign(n * n, 1);
+            alias.assign(n * n, 0);
+
+            vector<double> scaled(n);
+            vector<size_t> small, large;
+            small.reserve(n);
+            large.reserve(n);
+
+            for (size_t i = 0; i < n; ++i) {
+                double total = 0;
+                for (size_t j = 0; j < n; ++j) {
+                    if (transitions[i*n + j] < 0) throw invalid_argument("negative transition probability");
+                    total += transitions[i*n + j];
+                }
+
+                // what is left to 100% stays in the state
+                double stay = max(100.0 - total, 0.0);
+                total += stay;
+
+                small.clear();
+                large.clear();
+                for (size_t j = 0; j < n; ++j) {
+                    scaled[j] = (transitions[i*n + j] + (j == i ? stay : 0)) * n / total;
+                    alias[i*n + j] = j;
+                    (scaled[j] < 1 ? small : large).push_back(j);
+                }
+
+                while (!small.empty() && !large.empty()) {
+                    size_t s = small.back(), l = large.back();
+                    small.pop_back();
+                    large.pop_back();
+
+                    probability[i*n + s] = scaled[s];
+                    alias[i*n + s] = l;
+
+                    scaled[l] -= 1 - scaled[s];
+                    (scaled[l] < 1 ? small : large).push_back(l);
+                }
+                // leftovers are 1 up to rounding errors
+                for (size_t j : small) probability[i*n + j] = 1;
+                for (size_t j : large) probability[i*n + j] = 1;
+            }
+
+            lower.resize(n);
+            width.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                lower[i] = states[i].getLowerBound();
+                width[i] = states[i].getUpperBound() - states[i].getLowerBound();
+            }
+        }
+
+        size_t Markov::size() const {
+            return states.size();
+        }
+
+        const vector<double> &Markov::getTransitions() const {
+            return transitions;
+        }
+
+        const vector<Range> &Markov::getStates() const {
+            return states;
+        }
+
+        int32_t Markov::getCurrentState() const {
+            return currentState;
+        }
+
+        void Markov::setCurrentState(const int32_t &state) {
+            currentState = state;
+        }
+
+        void Markov::checkState() const {
+            if (currentState < 0 || static_cast<size_t>(currentState) >= states.size()) {
+                throw out_of_range("current state is out of bounds");
+            }
+        }
+
+        void Markov::next_state(const double &u) {
+            checkState();
+
+            const size_t n = states.size();
+            double x = u * n;
+            size_t column = min(static_cast<size_t>(x), n - 1);
+            size_t cell = currentState * n + column;
+
+            currentState = (x - column < probability[cell]) ? column : alias[cell];
+        }
+
+        double Markov::calculate_state(const double &u) const {
+            checkState();
+
+            return lower[currentState] + u * width[currentState];
+        }
+
+        void Markov::calculate_states(const size_t &n, const double *u, double *out) const {
+            checkState();
+
+            const double l = lower[currentState], w = width[currentState];
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = l + u[i] * w;
+            }
+        }
+
+        void Markov::generate(const size_t &n, int32_t *out, bsn::random::Philox &rng) {
+            double u[256];
+
+            for (size_t i = 0; i < n; ) {
+                size_t m = min(n - i, sizeof(u) / sizeof(u[0]));
+                rng.fill(u, m);
+
+                for (size_t k = 0; k < m; ++k, ++i) {
+                    next_state(u[k]);
+                    out[i] = currentState;
+                }
+            }
+        }
+
         const string Markov::toString() const {
             stringstream sstr;
 
-            sstr << "Markov " << "" << endl;
+            sstr << "Markov " << states.size() << " states, current " << currentState << endl;
+            for (size_t i = 0; i < states.size(); ++i) {
+                sstr << states[i].toString() << ":";
+                for (size_t j = 0; j < states.size(); ++j) {
+                    sstr << " " << transitions[i*states.size() + j];
+                }
+                sstr << endl;
+            }
 
             return sstr.str();
         }
@@ -0,0 +1,53 @@
+#include "libbsn/generator/NoiseGenerator.hpp"
+
+namespace bsn {
+    namespace generator {
+
+        NoiseGenerator::NoiseGenerator() : rng(), buffer() {}
+
+        NoiseGenerator::NoiseGenerator(const uint64_t &seed) : rng(seed), buffer() {}
+
+        NoiseGenerator::NoiseGenerator(const NoiseGenerator &obj) : rng(obj.rng), buffer() {}
+
+        NoiseGenerator& NoiseGenerator::operator=(const NoiseGenerator &obj) {
+            rng = obj.rng;
+            return (*this);
+        }
+
+        // +-(1 + U(0,1)), sign and magnitude taken from a single draw
+        inline double NoiseGenerator::draw() {
+            uint64_t x = rng.next();
+            double magnitude = 1.0 + (x >> 11) * (1.0 / 9007199254740992.0);
+            return (x & 1) ? -magnitude : magnitude;
+        }
+
+        double NoiseGenerator::apply(const double &data, const double &noise_factor) {
+            if (noise_factor == 0) return data;
+
+            return data + draw() * noise_factor * data;
+        }
+
+        double NoiseGenerator::replicate(const double &data, const double &noise_factor, const uint32_t &replicas) {
+            if (noise_factor == 0 || replicas == 0) return data;
+
+            buffer.resize(replicas);
+            double *terms = buffer.data();
+            for (uint32_t i = 0; i < replicas; ++i) terms[i] = draw();
+
+            // four independent partial sums, so that the reduction is not one long dependency chain
+            double sum[4] = {0, 0, 0, 0};
+            uint32_t i = 0;
+            for (; i + 4 <= replicas; i += 4) {
+                sum[0] += terms[i];
+                sum[1] += terms[i + 1];
+                sum[2] += terms[i + 2];
+                sum[3] += terms[i + 3];
+            }
+            for (; i < replicas; ++i) sum[0] += terms[i];
+
+            // mean of data + term * noise_factor * data over all replicas
+            return data + ((sum[0] + sum[1]) + (sum[2] + sum[3])) / replicas * noise_factor * data;
+        }
+
+    }
+}
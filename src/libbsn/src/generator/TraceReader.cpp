@@ -0,0 +1,91 @@
+#include "libbsn/generator/TraceReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace bsn {
+    namespace generator {
+
+        TraceReader::TraceReader(const std::string &path) : mapping(MAP_FAILED), length(0), header(), channels(), data(nullptr) {
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("could not open trace file " + path);
+
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(TraceHeader))) {
+                ::close(fd);
+                throw std::invalid_argument(path + " is not a trace file");
+            }
+
+            length = st.st_size;
+            mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) throw std::runtime_error("could not map trace file " + path);
+
+            const char *begin = static_cast<const char*>(mapping);
+            const char *end = begin + length;
+            std::memcpy(&header, begin, sizeof(header));
+
+            if (std::memcmp(header.magic, "BSNT", 4) != 0 || header.version != 1 || header.channels == 0) {
+                munmap(mapping, length);
+                throw std::invalid_argument(path + " is not a trace file");
+            }
+
+            const char *it = begin + sizeof(header);
+            for (uint32_t i = 0; i < header.channels; ++i) {
+                uint32_t size;
+                // compare against the bytes left, the header counts are not to be trusted
+                if (static_cast<size_t>(end - it) < sizeof(size)) break;
+                std::memcpy(&size, it, sizeof(size));
+                if (size > static_cast<size_t>(end - it) - sizeof(size)) break;
+                channels.push_back(std::string(it + sizeof(size), size));
+                size_t padded = sizeof(size) + size + (8 - (sizeof(size) + size) % 8) % 8;
+                it += std::min(padded, static_cast<size_t>(end - it));
+            }
+
+            if (channels.size() != header.channels || header.samples > static_cast<uint64_t>(end - it) / sizeof(float) / header.channels) {
+                munmap(mapping, length);
+                throw std::invalid_argument(path + " is truncated");
+            }
+
+            data = reinterpret_cast<const float*>(it);
+            madvise(mapping, length, MADV_SEQUENTIAL);
+        }
+
+        TraceReader::~TraceReader() {
+            if (mapping != MAP_FAILED) munmap(mapping, length);
+        }
+
+        const std::vector<std::string> &TraceReader::getChannels() const {
+            return channels;
+        }
+
+        uint32_t TraceReader::getChannelIndex(const std::string &channel) const {
+            for (uint32_t i = 0; i < channels.size(); ++i) {
+                if (channels[i] == channel) return i;
+            }
+            throw std::out_of_range("channel " + channel + " is not in the trace");
+        }
+
+        double TraceReader::getFrequency() const {
+            return header.frequency;
+        }
+
+        uint64_t TraceReader::getSamples() const {
+            return header.samples;
+        }
+
+        double TraceReader::at(const uint64_t &sample, const uint32_t &channel) const {
+            if (sample >= header.samples || channel >= header.channels) throw std::out_of_range("sample out of trace bounds");
+            return data[sample * header.channels + channel];
+        }
+
+        const float *TraceReader::row(const uint64_t &sample) const {
+            if (sample >= header.samples) throw std::out_of_range("sample out of trace bounds");
+            return data + sample * header.channels;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "libbsn/generator/TraceWriter.hpp"
+
+#include <cstring>
+
+namespace bsn {
+    namespace generator {
+
+        TraceWriter::TraceWriter(const std::string &path, const std::vector<std::string> &channels, const double &frequency) : file(), header(), buffer() {
+            if (channels.empty()) throw std::invalid_argument("trace needs at least one channel");
+            if (frequency <= 0) throw std::invalid_argument("trace frequency must be positive");
+
+            file.open(path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) throw std::runtime_error("could not open trace file " + path);
+
+            std::memcpy(header.magic, "BSNT", 4);
+            header.version = 1;
+            header.channels = channels.size();
+            header.reserved = 0;
+            header.frequency = frequency;
+            header.samples = 0;
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            const char padding[8] = {0};
+            for (const std::string &channel : channels) {
+                uint32_t size = channel.size();
+                file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+                file.write(channel.data(), size);
+                file.write(padding, (8 - (sizeof(size) + size) % 8) % 8);
+            }
+
+            buffer.resize(channels.size());
+        }
+
+        TraceWriter::~TraceWriter() {
+            try {
+                close();
+            } catch (const std::exception &) {}
+        }
+
+        void TraceWriter::append(const std::vector<double> &row) {
+            if (row.size() != header.channels) throw std::invalid_argument("row size does not match the number of channels");
+            append(row.data());
+        }
+
+        void TraceWriter::append(const double *row) {
+            if (!file.is_open()) throw std::runtime_error("trace file is closed");
+
+            for (uint32_t i = 0; i < header.channels; ++i) {
+                buffer[i] = static_cast<float>(row[i]);
+            }
+            file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(float));
+            ++header.samples;
+        }
+
+        void TraceWriter::close() {
+            if (!file.is_open()) return;
+
+            // the number of samples is only known now
+            file.seekp(0);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.close();
+            if (file.fail()) throw std::runtime_error("could not write trace file");
+        }
+
+        uint64_t TraceWriter::getSamples() const {
+            return header.samples;
+        }
+    }
+}
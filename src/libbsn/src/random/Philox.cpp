@@ -0,0 +1,161 @@
+#include "libbsn/random/Philox.hpp"
+
+namespace bsn {
+    namespace random {
+
+        namespace {
+            const uint32_t M0 = 0xD2511F53;
+            const uint32_t M1 = 0xCD9E8D57;
+            const uint32_t W0 = 0x9E3779B9;
+            const uint32_t W1 = 0xBB67AE85;
+
+            inline double to_double(const uint32_t hi, const uint32_t lo) {
+                return ((static_cast<uint64_t>(hi) << 32 | lo) >> 11) * (1.0 / 9007199254740992.0);
+            }
+        }
+
+        Philox::Philox() : key(), stream(0), block(0), output(), used(4) {
+            seed(0, 0);
+        }
+
+        Philox::Philox(const uint64_t &s, const uint64_t &id) : key(), stream(0), block(0), output(), used(4) {
+            seed(s, id);
+        }
+
+        Philox::Philox(const Philox &obj) :
+            key(obj.key),
+            stream(obj.stream),
+            block(obj.block),
+            output(obj.output),
+            used(obj.used) {}
+
+        Philox& Philox::operator=(const Philox &obj) {
+            key = obj.key;
+            stream = obj.stream;
+            block = obj.block;
+            output = obj.output;
+            used = obj.used;
+            return (*this);
+        }
+
+        void Philox::seed(const uint64_t &s, const uint64_t &id) {
+            key[0] = static_cast<uint32_t>(s);
+            key[1] = static_cast<uint32_t>(s >> 32);
+            stream = id;
+            seek(0);
+        }
+
+        void Philox::seek(const uint64_t &index) {
+            block = index;
+            used = 4;
+        }
+
+        uint64_t Philox::tell() const {
+            return block;
+        }
+
+        /*
+         * lanes consecutive blocks at once: the lanes are independent, so the
+         * rounds of one hide the multiply latency of the others (and vectorize)
+         */
+        template <int lanes>
+        inline void philox_rounds(uint32_t (&c)[4][lanes], const std::array<uint32_t, 2> &key) {
+            uint32_t k0 = key[0];
+            uint32_t k1 = key[1];
+
+            for (int round = 0; round < 10; ++round) {
+                for (int l = 0; l < lanes; ++l) {
+                    uint64_t p0 = static_cast<uint64_t>(M0) * c[0][l];
+                    uint64_t p1 = static_cast<uint64_t>(M1) * c[2][l];
+
+                    c[0][l] = static_cast<uint32_t>(p1 >> 32) ^ c[1][l] ^ k0;
+                    c[2][l] = static_cast<uint32_t>(p0 >> 32) ^ c[3][l] ^ k1;
+                    c[1][l] = static_cast<uint32_t>(p1);
+                    c[3][l] = static_cast<uint32_t>(p0);
+                }
+
+                k0 += W0;
+                k1 += W1;
+            }
+        }
+
+        template <int lanes>
+        inline void philox_counters(uint32_t (&c)[4][lanes], const uint64_t &index, const uint64_t &stream) {
+            for (int l = 0; l < lanes; ++l) {
+                c[0][l] = static_cast<uint32_t>(index + l);
+                c[1][l] = static_cast<uint32_t>((index + l) >> 32);
+                c[2][l] = static_cast<uint32_t>(stream);
+                c[3][l] = static_cast<uint32_t>(stream >> 32);
+            }
+        }
+
+        std::array<uint32_t, 4> Philox::generate(const uint64_t &index) const {
+            uint32_t c[4][1];
+            philox_counters<1>(c, index, stream);
+            philox_rounds<1>(c, key);
+
+            std::array<uint32_t, 4> words = {{c[0][0], c[1][0], c[2][0], c[3][0]}};
+            return words;
+        }
+
+        uint32_t Philox::next() {
+            if (used == 4) {
+                output = generate(block++);
+                used = 0;
+            }
+            return output[used++];
+        }
+
+        double Philox::uniform() {
+            uint32_t hi = next();
+            return to_double(hi, next());
+        }
+
+        double Philox::uniform(const double &lower, const double &upper) {
+            return lower + uniform() * (upper - lower);
+        }
+
+        int32_t Philox::uniform_int(const int32_t &lower, const int32_t &upper) {
+            uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(upper) - lower) + 1;
+            return static_cast<int32_t>(lower + static_cast<int64_t>((next() * range) >> 32));
+        }
+
+        void Philox::fill(double *out, const size_t &n) {
+            size_t i = 0;
+
+            // whole blocks straight from the counter, eight at a time, no buffering
+            if (used == 4) {
+                uint32_t c[4][8];
+                for (; i + 16 <= n; i += 16, block += 8) {
+                    philox_counters<8>(c, block, stream);
+                    philox_rounds<8>(c, key);
+                    for (int l = 0; l < 8; ++l) {
+                        out[i + 2*l] = to_double(c[0][l], c[1][l]);
+                        out[i + 2*l + 1] = to_double(c[2][l], c[3][l]);
+                    }
+                }
+            }
+            for (; i < n; ++i) out[i] = uniform();
+        }
+
+        void Philox::fill(uint32_t *out, const size_t &n) {
+            size_t i = 0;
+
+            if (used == 4) {
+                uint32_t c[4][8];
+                for (; i + 32 <= n; i += 32, block += 8) {
+                    philox_counters<8>(c, block, stream);
+                    philox_rounds<8>(c, key);
+                    for (int l = 0; l < 8; ++l) {
+                        out[i + 4*l] = c[0][l];
+                        out[i + 4*l + 1] = c[1][l];
+                        out[i + 4*l + 2] = c[2][l];
+                        out[i + 4*l + 3] = c[3][l];
+                    }
+                }
+            }
+            for (; i < n; ++i) out[i] = next();
+        }
+
+    }
+}
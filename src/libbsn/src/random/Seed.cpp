@@ -0,0 +1,31 @@
+#include "libbsn/random/Seed.hpp"
+
+#include <random>
+
+namespace bsn {
+    namespace random {
+
+        uint64_t stream_id(const std::string &name) {
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            for (const char &c : name) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x100000001b3ULL;
+            }
+            return hash;
+        }
+
+        uint64_t seed_for(const uint64_t &seed, const std::string &name) {
+            // splitmix64 finalizer, so that close seeds give unrelated streams
+            uint64_t z = seed ^ stream_id(name);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        uint64_t random_seed() {
+            std::random_device rd;
+            return (static_cast<uint64_t>(rd()) << 32) | rd();
+        }
+
+    }
+}
@@ -0,0 +1,67 @@
+#include "libbsn/random/Xoshiro256.hpp"
+
+namespace bsn {
+    namespace random {
+
+        namespace {
+            inline uint64_t rotl(const uint64_t x, int k) {
+                return (x << k) | (x >> (64 - k));
+            }
+
+            inline uint64_t splitmix64(uint64_t &x) {
+                uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                return z ^ (z >> 31);
+            }
+
+            // top 53 bits as a double in [0,1)
+            inline double to_double(const uint64_t x) {
+                return (x >> 11) * (1.0 / 9007199254740992.0);
+            }
+        }
+
+        Xoshiro256::Xoshiro256() : state() {
+            seed(0);
+        }
+
+        Xoshiro256::Xoshiro256(const uint64_t &s) : state() {
+            seed(s);
+        }
+
+        Xoshiro256::Xoshiro256(const Xoshiro256 &obj) : state(obj.state) {}
+
+        Xoshiro256& Xoshiro256::operator=(const Xoshiro256 &obj) {
+            state = obj.state;
+            return (*this);
+        }
+
+        void Xoshiro256::seed(const uint64_t &s) {
+            uint64_t x = s;
+            for (uint64_t &word : state) word = splitmix64(x);
+        }
+
+        uint64_t Xoshiro256::next() {
+            const uint64_t result = rotl(state[1] * 5, 7) * 9;
+            const uint64_t t = state[1] << 17;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotl(state[3], 45);
+
+            return result;
+        }
+
+        double Xoshiro256::uniform() {
+            return to_double(next());
+        }
+
+        void Xoshiro256::fill(double *out, const size_t &n) {
+            for (size_t i = 0; i < n; ++i) out[i] = to_double(next());
+        }
+
+    }
+}
@@ -0,0 +1,174 @@
+#include "libbsn/storage/ColumnReader.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace bsn {
+    namespace storage {
+
+        namespace {
+            uint64_t varint(const char *&it, const char *end) {
+                uint64_t value = 0;
+                for (uint32_t shift = 0; it != end && shift < 64; shift += 7) {
+                    uint8_t byte = *it++;
+                    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                    if (!(byte & 0x80)) return value;
+                }
+                throw std::invalid_argument("corrupt column chunk");
+            }
+
+            bool integer(const Column &column) {
+                return column == LOGICAL_CLOCK || column == TIMESTAMP;
+            }
+        }
+
+        ColumnReader::ColumnReader(const std::string &path) : mapping(MAP_FAILED), length(0), blocks(), offsets(), rows(0) {
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("could not open column file " + path);
+
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(ColumnHeader))) {
+                ::close(fd);
+                throw std::invalid_argument(path + " is not a column file");
+            }
+
+            length = st.st_size;
+            mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) throw std::runtime_error("could not map column file " + path);
+
+            const char *begin = static_cast<const char*>(mapping);
+            const char *end = begin + length;
+
+            ColumnHeader header;
+            std::memcpy(&header, begin, sizeof(header));
+            if (std::memcmp(header.magic, "BSNC", 4) != 0 || header.version != 1 || header.columns != COLUMNS) {
+                munmap(mapping, length);
+                throw std::invalid_argument(path + " is not a column file");
+            }
+
+            // only the block headers are read here, to find the chunks
+            const char *it = begin + sizeof(header);
+            while (static_cast<size_t>(end - it) >= sizeof(ColumnBlockHeader)) {
+                ColumnBlockHeader block;
+                std::memcpy(&block, it, sizeof(block));
+
+                uint64_t size = 0;
+                for (int i = 0; i < COLUMNS; ++i) {
+                    size += block.sizes[i];
+                }
+                if (size > static_cast<uint64_t>(end - it) - sizeof(block)) break;
+
+                blocks.push_back(block);
+                offsets.push_back(it + sizeof(block));
+                rows += block.rows;
+                it += sizeof(block) + size;
+            }
+        }
+
+        ColumnReader::~ColumnReader() {
+            if (mapping != MAP_FAILED) munmap(mapping, length);
+        }
+
+        uint64_t ColumnReader::getRows() const {
+            return rows;
+        }
+
+        size_t ColumnReader::getBlocks() const {
+            return blocks.size();
+        }
+
+        const ColumnBlockHeader &ColumnReader::getBlock(const size_t &block) const {
+            if (block >= blocks.size()) throw std::out_of_range("block out of column file bounds");
+            return blocks[block];
+        }
+
+        const char *ColumnReader::chunk(const size_t &block, const Column &column) const {
+            if (block >= blocks.size()) throw std::out_of_range("block out of column file bounds");
+            if (column < 0 || column >= COLUMNS) throw std::invalid_argument("not a column");
+
+            const char *it = offsets[block];
+            for (int i = 0; i < column; ++i) {
+                it += blocks[block].sizes[i];
+            }
+            return it;
+        }
+
+        void ColumnReader::read(const size_t &block, const Column &column, std::vector<int64_t> &values) const {
+            if (!integer(column)) throw std::invalid_argument("not an integer column");
+
+            const char *it = chunk(block, column);
+            const char *end = it + blocks[block].sizes[column];
+
+            values.reserve(values.size() + blocks[block].rows);
+            uint64_t value = 0;
+            for (uint32_t i = 0; i < blocks[block].rows; ++i) {
+                uint64_t zigzag = varint(it, end);
+                value += (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+                values.push_back(static_cast<int64_t>(value));
+            }
+        }
+
+        void ColumnReader::read(const size_t &block, const Column &column, std::vector<uint32_t> &codes, std::vector<std::string> &dictionary) const {
+            if (integer(column)) throw std::invalid_argument("not a string column");
+
+            const char *it = chunk(block, column);
+            const char *end = it + blocks[block].sizes[column];
+
+            uint64_t size = varint(it, end);
+            if (size > static_cast<uint64_t>(end - it)) throw std::invalid_argument("corrupt column chunk");
+            dictionary.clear();
+            dictionary.reserve(size);
+            for (uint64_t i = 0; i < size; ++i) {
+                uint64_t n = varint(it, end);
+                if (n > static_cast<uint64_t>(end - it)) throw std::invalid_argument("corrupt column chunk");
+                dictionary.push_back(std::string(it, n));
+                it += n;
+            }
+
+            if (it == end) throw std::invalid_argument("corrupt column chunk");
+            uint32_t width = static_cast<uint8_t>(*it++);
+            if (width > 32 || (static_cast<uint64_t>(blocks[block].rows) * width + 7) / 8 > static_cast<uint64_t>(end - it)) throw std::invalid_argument("corrupt column chunk");
+
+            codes.clear();
+            codes.reserve(blocks[block].rows);
+            uint64_t bits = 0, mask = (static_cast<uint64_t>(1) << width) - 1;
+            uint32_t available = 0;
+            for (uint32_t i = 0; i < blocks[block].rows; ++i) {
+                for (; available < width; available += 8) bits |= static_cast<uint64_t>(static_cast<uint8_t>(*it++)) << available;
+
+                uint32_t code = bits & mask;
+                if (code >= dictionary.size()) throw std::invalid_argument("corrupt column chunk");
+                codes.push_back(code);
+                bits >>= width;
+                available -= width;
+            }
+        }
+
+        void ColumnReader::read(const size_t &block, const Column &column, std::vector<std::string> &values) const {
+            std::vector<uint32_t> codes;
+            std::vector<std::string> dictionary;
+            read(block, column, codes, dictionary);
+
+            values.reserve(values.size() + codes.size());
+            for (uint32_t code : codes) {
+                values.push_back(dictionary[code]);
+            }
+        }
+
+        void ColumnReader::read(const Column &column, std::vector<int64_t> &values) const {
+            for (size_t block = 0; block < blocks.size(); ++block) {
+                read(block, column, values);
+            }
+        }
+
+        void ColumnReader::read(const Column &column, std::vector<std::string> &values) const {
+            for (size_t block = 0; block < blocks.size(); ++block) {
+                read(block, column, values);
+            }
+        }
+    }
+}
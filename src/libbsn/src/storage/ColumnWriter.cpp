@@ -0,0 +1,146 @@
+#include "libbsn/storage/ColumnWriter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace bsn {
+    namespace storage {
+
+        namespace {
+            void varint(std::string &out, uint64_t value) {
+                while (value >= 0x80) {
+                    out += static_cast<char>(value | 0x80);
+                    value >>= 7;
+                }
+                out += static_cast<char>(value);
+            }
+
+            // small deltas of either sign make short varints
+            void deltas(std::string &out, const std::vector<int64_t> &values) {
+                uint64_t previous = 0;
+                for (int64_t value : values) {
+                    int64_t delta = static_cast<int64_t>(static_cast<uint64_t>(value) - previous);
+                    varint(out, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+                    previous = value;
+                }
+            }
+
+            void dictionary(std::string &out, const std::vector<std::string> &values, const std::vector<uint32_t> &codes) {
+                varint(out, values.size());
+                for (const std::string &value : values) {
+                    varint(out, value.size());
+                    out += value;
+                }
+
+                uint8_t width = 0;
+                while ((static_cast<uint64_t>(1) << width) < values.size()) ++width;
+                out += static_cast<char>(width);
+
+                uint64_t bits = 0;
+                uint32_t used = 0;
+                for (uint32_t code : codes) {
+                    bits |= static_cast<uint64_t>(code) << used;
+                    used += width;
+                    for (; used >= 8; used -= 8, bits >>= 8) out += static_cast<char>(bits);
+                }
+                if (used > 0) out += static_cast<char>(bits);
+            }
+        }
+
+        ColumnWriter::ColumnWriter(const std::string &path, const uint32_t &block_rows) : file(), block_rows(block_rows), rows(0), clocks(), timestamps(), names(), sources(), targets(), contents() {
+            if (block_rows == 0) throw std::invalid_argument("column blocks need at least one row");
+
+            file.open(path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) throw std::runtime_error("could not open column file " + path);
+
+            ColumnHeader header;
+            std::memcpy(header.magic, "BSNC", 4);
+            header.version = 1;
+            header.columns = COLUMNS;
+            header.reserved = 0;
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+
+        ColumnWriter::~ColumnWriter() {
+            try {
+                close();
+            } catch (const std::exception &) {}
+        }
+
+        void ColumnWriter::add(Dictionary &dictionary, const std::string &value) {
+            std::map<std::string, uint32_t>::iterator it = dictionary.index.find(value);
+            if (it == dictionary.index.end()) {
+                it = dictionary.index.insert(std::make_pair(value, static_cast<uint32_t>(dictionary.values.size()))).first;
+                dictionary.values.push_back(value);
+            }
+            dictionary.codes.push_back(it->second);
+        }
+
+        void ColumnWriter::append(const std::string &name, const int64_t &logical_clock, const int64_t &timestamp,
+                                  const std::string &source, const std::string &target, const std::string &content) {
+            if (!file.is_open()) throw std::runtime_error("column file is closed");
+
+            clocks.push_back(logical_clock);
+            timestamps.push_back(timestamp);
+            add(names, name);
+            add(sources, source);
+            add(targets, target);
+            add(contents, content);
+
+            if (clocks.size() >= block_rows) flush();
+        }
+
+        void ColumnWriter::flush() {
+            if (!file.is_open() || clocks.empty()) return;
+
+            std::string chunks[COLUMNS];
+            dictionary(chunks[NAME], names.values, names.codes);
+            deltas(chunks[LOGICAL_CLOCK], clocks);
+            deltas(chunks[TIMESTAMP], timestamps);
+            dictionary(chunks[SOURCE], sources.values, sources.codes);
+            dictionary(chunks[TARGET], targets.values, targets.codes);
+            dictionary(chunks[CONTENT], contents.values, contents.codes);
+
+            ColumnBlockHeader block;
+            block.rows = clocks.size();
+            block.reserved = 0;
+            block.min_clock = *std::min_element(clocks.begin(), clocks.end());
+            block.max_clock = *std::max_element(clocks.begin(), clocks.end());
+            block.min_timestamp = *std::min_element(timestamps.begin(), timestamps.end());
+            block.max_timestamp = *std::max_element(timestamps.begin(), timestamps.end());
+            for (int i = 0; i < COLUMNS; ++i) {
+                block.sizes[i] = chunks[i].size();
+            }
+
+            file.write(reinterpret_cast<const char*>(&block), sizeof(block));
+            for (int i = 0; i < COLUMNS; ++i) {
+                file.write(chunks[i].data(), chunks[i].size());
+            }
+            // a reader sees whole blocks only
+            file.flush();
+            if (file.fail()) throw std::runtime_error("could not write column file");
+
+            rows += clocks.size();
+            clocks.clear();
+            timestamps.clear();
+            Dictionary *dictionaries[] = {&names, &sources, &targets, &contents};
+            for (Dictionary *dictionary : dictionaries) {
+                dictionary->index.clear();
+                dictionary->values.clear();
+                dictionary->codes.clear();
+            }
+        }
+
+        void ColumnWriter::close() {
+            if (!file.is_open()) return;
+
+            flush();
+            file.close();
+            if (file.fail()) throw std::runtime_error("could not write column file");
+        }
+
+        uint64_t ColumnWriter::getRows() const {
+            return rows + clocks.size();
+        }
+    }
+}
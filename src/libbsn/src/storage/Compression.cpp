@@ -0,0 +1,127 @@
+#include "libbsn/storage/Compression.hpp"
+
+#include <cstring>
+#include <vector>
+#include <stdint.h>
+
+namespace bsn {
+    namespace storage {
+
+        namespace {
+            const size_t min_match = 4;
+            // the format leaves the last 5 bytes as literals and starts no match in the last 12
+            const size_t last_literals = 5;
+            const size_t match_limit = 12;
+            const size_t max_offset = 65535;
+            const int hash_bits = 12;
+
+            uint32_t read32(const char *p) {
+                uint32_t value;
+                std::memcpy(&value, p, sizeof(value));
+                return value;
+            }
+
+            uint32_t hash(const uint32_t &sequence) {
+                return (sequence * 2654435761U) >> (32 - hash_bits);
+            }
+
+            void length(std::string &out, size_t n) {
+                for (; n >= 255; n -= 255) out += static_cast<char>(255);
+                out += static_cast<char>(n);
+            }
+
+            void sequence(std::string &out, const char *literals, const size_t &literal_length, const size_t &offset, const size_t &match_length) {
+                size_t token = literal_length < 15 ? literal_length : 15;
+                size_t match = match_length - min_match;
+                out += static_cast<char>((token << 4) | (match < 15 ? match : 15));
+
+                if (literal_length >= 15) length(out, literal_length - 15);
+                out.append(literals, literal_length);
+
+                out += static_cast<char>(offset & 0xff);
+                out += static_cast<char>(offset >> 8);
+                if (match >= 15) length(out, match - 15);
+            }
+
+            size_t length(const char *&it, const char *end) {
+                size_t n = 0;
+                uint8_t byte;
+                do {
+                    if (it == end) throw std::invalid_argument("corrupt compressed block");
+                    byte = *it++;
+                    n += byte;
+                } while (byte == 255);
+                return n;
+            }
+        }
+
+        void compress(const char *data, const size_t &size, std::string &out) {
+            size_t anchor = 0;
+
+            if (size > match_limit) {
+                std::vector<int64_t> table(static_cast<size_t>(1) << hash_bits, -1);
+                size_t limit = size - match_limit;
+
+                for (size_t i = 0; i < limit;) {
+                    uint32_t h = hash(read32(data + i));
+                    int64_t candidate = table[h];
+                    table[h] = i;
+
+                    if (candidate < 0 || i - candidate > max_offset || read32(data + candidate) != read32(data + i)) {
+                        ++i;
+                        continue;
+                    }
+
+                    size_t match = min_match;
+                    while (i + match < size - last_literals && data[candidate + match] == data[i + match]) ++match;
+
+                    sequence(out, data + anchor, i - anchor, i - candidate, match);
+                    i += match;
+                    anchor = i;
+                }
+            }
+
+            // the rest, as literals only
+            size_t rest = size - anchor;
+            out += static_cast<char>((rest < 15 ? rest : 15) << 4);
+            if (rest >= 15) length(out, rest - 15);
+            out.append(data + anchor, rest);
+        }
+
+        void decompress(const char *data, const size_t &compressed, char *out, const size_t &size) {
+            const char *it = data, *end = data + compressed;
+            char *op = out, *oend = out + size;
+
+            while (it != end) {
+                uint8_t token = *it++;
+
+                size_t literals = token >> 4;
+                if (literals == 15) literals += length(it, end);
+                if (literals > static_cast<size_t>(end - it) || literals > static_cast<size_t>(oend - op)) throw std::invalid_argument("corrupt compressed block");
+                std::memcpy(op, it, literals);
+                it += literals;
+                op += literals;
+
+                // the last sequence has no match
+                if (it == end) break;
+
+                if (end - it < 2) throw std::invalid_argument("corrupt compressed block");
+                size_t offset = static_cast<uint8_t>(it[0]) | static_cast<size_t>(static_cast<uint8_t>(it[1])) << 8;
+                it += 2;
+                if (offset == 0 || offset > static_cast<size_t>(op - out)) throw std::invalid_argument("corrupt compressed block");
+
+                size_t match = token & 15;
+                if (match == 15) match += length(it, end);
+                match += min_match;
+                if (match > static_cast<size_t>(oend - op)) throw std::invalid_argument("corrupt compressed block");
+
+                // the match may overlap what it copies
+                const char *from = op - offset;
+                for (size_t i = 0; i < match; ++i) op[i] = from[i];
+                op += match;
+            }
+
+            if (op != oend) throw std::invalid_argument("corrupt compressed block");
+        }
+    }
+}
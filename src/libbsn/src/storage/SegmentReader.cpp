@@ -0,0 +1,180 @@
+#include "libbsn/storage/SegmentReader.hpp"
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "libbsn/storage/Compression.hpp"
+#include "libbsn/utils/utils.hpp"
+
+namespace bsn {
+    namespace storage {
+
+        namespace {
+            bool readable(const std::string &path) {
+                return std::ifstream(path).is_open();
+            }
+        }
+
+        SegmentReader::SegmentReader(const std::string &dir, const std::string &name) :
+            dir(dir),
+            name(name),
+            segments(),
+            indexed(),
+            from(std::numeric_limits<int64_t>::min()),
+            to(std::numeric_limits<int64_t>::max()),
+            segment(0),
+            file(),
+            compressed(false),
+            frames(0),
+            lines(),
+            position(0),
+            inside(true) {
+            std::ifstream index(dir + "/" + name + ".idx");
+            std::string line;
+            while (std::getline(index, line)) {
+                std::vector<std::string> fields = utils::split(line, ',');
+                SegmentIndex entry;
+                int64_t number, rows;
+                if (fields.size() != 6 || !utils::parse(fields[0], number) || !utils::parse(fields[1], rows) ||
+                    !utils::parse(fields[2], entry.min_clock) || !utils::parse(fields[3], entry.max_clock) ||
+                    !utils::parse(fields[4], entry.min_timestamp) || !utils::parse(fields[5], entry.max_timestamp)) {
+                    // the last line, if cut short by a crash
+                    continue;
+                }
+                entry.segment = number;
+                entry.rows = rows;
+
+                indexed[entry.segment] = segments.size();
+                segments.push_back(entry);
+            }
+        }
+
+        SegmentReader::~SegmentReader() {}
+
+        bool SegmentReader::exists(const std::string &dir, const std::string &name) {
+            return readable(dir + "/" + name + ".idx") || readable(SegmentedLog::path(dir, name, 0, "log"));
+        }
+
+        const std::vector<SegmentIndex> &SegmentReader::getSegments() const {
+            return segments;
+        }
+
+        void SegmentReader::seek(const int64_t &from, const int64_t &to) {
+            this->from = from;
+            this->to = to;
+
+            segment = 0;
+            file.close();
+            file.clear();
+            lines.clear();
+            position = 0;
+        }
+
+        bool SegmentReader::open() {
+            file.close();
+            file.clear();
+
+            for (;; ++segment) {
+                std::map<uint32_t, size_t>::const_iterator it = indexed.find(segment);
+                if (it != indexed.end()) {
+                    const SegmentIndex &entry = segments[it->second];
+                    if (entry.max_timestamp < from || entry.min_timestamp > to) continue;
+                }
+
+                std::string seg = SegmentedLog::path(dir, name, segment, "seg");
+                auto openCompressed = [&]() {
+                    file.clear();
+                    file.open(seg, std::ios::binary);
+                    if (!file.is_open()) return false;
+
+                    SegmentHeader header;
+                    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, "BSNS", 4) != 0 || header.version != 1) {
+                        throw std::invalid_argument(seg + " is not a segment");
+                    }
+                    compressed = true;
+                    frames = header.frames;
+                    return true;
+                };
+                auto openPlain = [&]() {
+                    file.clear();
+                    file.open(SegmentedLog::path(dir, name, segment, "log"));
+                    compressed = false;
+                    return file.is_open();
+                };
+
+                // compressed since the index was read, or still plain text; the .seg is looked
+                // for again in case the compression replaced the .log in between
+                if (openCompressed() || openPlain() || openCompressed()) {
+                    ++segment;
+                    return true;
+                }
+
+                // past the last segment
+                if (it == indexed.end()) return false;
+            }
+        }
+
+        bool SegmentReader::frame() {
+            lines.clear();
+            position = 0;
+
+            while (frames > 0) {
+                --frames;
+
+                SegmentFrame header;
+                if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) throw std::invalid_argument(SegmentedLog::path(dir, name, segment - 1, "seg") + " is truncated");
+
+                if (header.max_timestamp < from || header.min_timestamp > to) {
+                    file.seekg(header.compressed, std::ios::cur);
+                    continue;
+                }
+
+                std::vector<char> packed(header.compressed);
+                if (!file.read(packed.data(), packed.size())) throw std::invalid_argument(SegmentedLog::path(dir, name, segment - 1, "seg") + " is truncated");
+
+                lines.resize(header.size);
+                if (header.compressed == header.size) {
+                    lines.assign(packed.begin(), packed.end());
+                } else {
+                    decompress(packed.data(), packed.size(), &lines[0], lines.size());
+                }
+                inside = from <= header.min_timestamp && header.max_timestamp <= to;
+                return true;
+            }
+            return false;
+        }
+
+        bool SegmentReader::inRange(const std::string &line) const {
+            if (from == std::numeric_limits<int64_t>::min() && to == std::numeric_limits<int64_t>::max()) return true;
+
+            int64_t clock, timestamp;
+            return SegmentedLog::clocks(line, clock, timestamp) && from <= timestamp && timestamp <= to;
+        }
+
+        bool SegmentReader::next(std::string &line) {
+            while (true) {
+                if (!file.is_open() && !open()) return false;
+
+                if (!compressed) {
+                    // a last line without its newline is still being written
+                    while (std::getline(file, line) && !file.eof()) {
+                        if (inRange(line)) return true;
+                    }
+                    file.close();
+                    continue;
+                }
+
+                while (position < lines.size() || frame()) {
+                    size_t end = lines.find('\n', position);
+                    if (end == std::string::npos) end = lines.size();
+                    line.assign(lines, position, end - position);
+                    position = end + 1;
+
+                    if (inside || inRange(line)) return true;
+                }
+                file.close();
+            }
+        }
+    }
+}
@@ -0,0 +1,223 @@
+#include "libbsn/storage/SegmentedLog.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+#include "libbsn/storage/Compression.hpp"
+#include "libbsn/utils/utils.hpp"
+
+namespace bsn {
+    namespace storage {
+
+        namespace {
+            void reset(SegmentFrame &frame) {
+                std::memset(&frame, 0, sizeof(frame));
+                frame.min_clock = frame.min_timestamp = std::numeric_limits<int64_t>::max();
+                frame.max_clock = frame.max_timestamp = std::numeric_limits<int64_t>::min();
+            }
+
+            // lines without a logical clock and a timestamp still count as rows
+            void count(SegmentFrame &frame, const std::string &line) {
+                ++frame.rows;
+
+                int64_t clock, timestamp;
+                if (!SegmentedLog::clocks(line, clock, timestamp)) return;
+
+                frame.min_clock = std::min(frame.min_clock, clock);
+                frame.max_clock = std::max(frame.max_clock, clock);
+                frame.min_timestamp = std::min(frame.min_timestamp, timestamp);
+                frame.max_timestamp = std::max(frame.max_timestamp, timestamp);
+            }
+
+            void merge(SegmentFrame &total, const SegmentFrame &frame) {
+                total.rows += frame.rows;
+                total.min_clock = std::min(total.min_clock, frame.min_clock);
+                total.max_clock = std::max(total.max_clock, frame.max_clock);
+                total.min_timestamp = std::min(total.min_timestamp, frame.min_timestamp);
+                total.max_timestamp = std::max(total.max_timestamp, frame.max_timestamp);
+            }
+        }
+
+        const uint32_t SegmentedLog::frame_bytes = 64 * 1024;
+
+        SegmentedLog::SegmentedLog(const std::string &dir, const std::string &name, const uint64_t &max_bytes, const double &max_seconds) :
+            dir(dir),
+            name(name),
+            max_bytes(max_bytes),
+            max_seconds(max_seconds),
+            file(),
+            segment(0),
+            bytes(0),
+            opened(),
+            mutex(),
+            pending(),
+            queue(),
+            closing(false),
+            worker() {
+            // the index is there from the start, so readers know the log is segmented
+            std::ofstream index(dir + "/" + name + ".idx", std::ios::trunc);
+            if (!index.is_open()) throw std::runtime_error("could not open " + dir + "/" + name + ".idx");
+            index.close();
+
+            worker = std::thread(&SegmentedLog::work, this);
+        }
+
+        SegmentedLog::~SegmentedLog() {
+            try {
+                close();
+            } catch (const std::exception &) {}
+        }
+
+        std::string SegmentedLog::path(const std::string &dir, const std::string &name, const uint32_t &segment, const std::string &extension) {
+            return dir + "/" + name + "." + std::to_string(segment) + "." + extension;
+        }
+
+        bool SegmentedLog::clocks(const utils::StringView &line, int64_t &clock, int64_t &timestamp) {
+            size_t first = line.find(',');
+            size_t second = first == utils::StringView::npos ? first : line.find(',', first + 1);
+            if (second == utils::StringView::npos) return false;
+            size_t third = line.find(',', second + 1);
+
+            return utils::parse(line.substr(first + 1, second - first - 1), clock) &&
+                   utils::parse(line.substr(second + 1, third == utils::StringView::npos ? third : third - second - 1), timestamp);
+        }
+
+        void SegmentedLog::append(const std::string &line) {
+            if (!file.is_open()) {
+                file.open(path(dir, name, segment, "log"), std::ios::trunc);
+                if (!file.is_open()) throw std::runtime_error("could not open segment " + path(dir, name, segment, "log"));
+                opened = std::chrono::steady_clock::now();
+            }
+
+            file << line << '\n';
+            bytes += line.size() + 1;
+
+            if ((max_bytes > 0 && bytes >= max_bytes) ||
+                (max_seconds > 0 && std::chrono::duration<double>(std::chrono::steady_clock::now() - opened).count() >= max_seconds)) {
+                rotate();
+            }
+        }
+
+        void SegmentedLog::flush() {
+            if (file.is_open()) file.flush();
+        }
+
+        void SegmentedLog::rotate() {
+            if (!file.is_open()) return;
+            file.close();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back(segment);
+            }
+            pending.notify_one();
+
+            ++segment;
+            bytes = 0;
+        }
+
+        void SegmentedLog::close() {
+            rotate();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                closing = true;
+            }
+            pending.notify_one();
+            if (worker.joinable()) worker.join();
+        }
+
+        void SegmentedLog::work() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                pending.wait(lock, [this] { return closing || !queue.empty(); });
+                if (queue.empty()) return;
+
+                uint32_t next = queue.front();
+                queue.pop_front();
+
+                lock.unlock();
+                try {
+                    compress(dir, name, next);
+                } catch (const std::exception &e) {
+                    // the plain segment stays, readers read it as it is
+                    std::cerr << e.what() << std::endl;
+                }
+                lock.lock();
+            }
+        }
+
+        void SegmentedLog::compress(const std::string &dir, const std::string &name, const uint32_t &segment) {
+            std::string plain = path(dir, name, segment, "log");
+            std::string compressed = path(dir, name, segment, "seg");
+            std::string temporary = compressed + ".tmp";
+
+            std::ifstream in(plain);
+            if (!in.is_open()) throw std::runtime_error("could not open segment " + plain);
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) throw std::runtime_error("could not open segment " + temporary);
+
+            SegmentHeader header;
+            std::memcpy(header.magic, "BSNS", 4);
+            header.version = 1;
+            header.frames = 0;
+            header.reserved = 0;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            SegmentFrame total, frame;
+            reset(total);
+            reset(frame);
+            std::string lines, packed, line;
+
+            // whole lines, up to frame_bytes of them
+            auto write = [&]() {
+                packed.clear();
+                storage::compress(lines.data(), lines.size(), packed);
+                if (packed.size() >= lines.size()) packed = lines;
+
+                frame.size = lines.size();
+                frame.compressed = packed.size();
+                out.write(reinterpret_cast<const char*>(&frame), sizeof(frame));
+                out.write(packed.data(), packed.size());
+                ++header.frames;
+                merge(total, frame);
+
+                reset(frame);
+                lines.clear();
+            };
+
+            while (std::getline(in, line)) {
+                if (!lines.empty() && lines.size() + line.size() + 1 > frame_bytes) write();
+                lines += line;
+                lines += '\n';
+                count(frame, line);
+            }
+            if (!lines.empty()) write();
+
+            out.seekp(0);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.close();
+            if (out.fail() || in.bad()) {
+                std::remove(temporary.c_str());
+                throw std::runtime_error("could not write segment " + compressed);
+            }
+
+            // the compressed segment is whole before it is indexed, and indexed before the plain one goes
+            if (std::rename(temporary.c_str(), compressed.c_str()) != 0) {
+                std::remove(temporary.c_str());
+                throw std::runtime_error("could not write segment " + compressed);
+            }
+
+            std::ofstream index(dir + "/" + name + ".idx", std::ios::app);
+            index << segment << "," << total.rows << "," << total.min_clock << "," << total.max_clock << ","
+                  << total.min_timestamp << "," << total.max_timestamp << "\n";
+            index.close();
+            if (index.fail()) throw std::runtime_error("could not index segment " + compressed);
+
+            std::remove(plain.c_str());
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include "libbsn/storage/TimeIndex.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "libbsn/storage/SegmentedLog.hpp"
+
+namespace bsn {
+    namespace storage {
+
+        namespace {
+            TimeIndexBlock block(const uint64_t &offset) {
+                TimeIndexBlock block;
+                std::memset(&block, 0, sizeof(block));
+                block.offset = offset;
+                block.min_clock = block.min_timestamp = std::numeric_limits<int64_t>::max();
+                block.max_clock = block.max_timestamp = std::numeric_limits<int64_t>::min();
+                return block;
+            }
+
+            uint64_t size(const std::string &path) {
+                std::ifstream file(path, std::ios::binary | std::ios::ate);
+                return file.is_open() ? static_cast<uint64_t>(file.tellg()) : 0;
+            }
+        }
+
+        TimeIndex::TimeIndex(const std::string &log, const std::string &index, const uint32_t &every) :
+            log(log),
+            index(index),
+            every(std::max<uint32_t>(every, 1)),
+            blocks(),
+            full(0) {
+            load();
+        }
+
+        TimeIndex::~TimeIndex() {}
+
+        void TimeIndex::load() {
+            std::ifstream file(index, std::ios::binary);
+            TimeIndexHeader header;
+            if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+                std::memcmp(header.magic, "BSNI", 4) != 0 || header.version != 1 || header.every != every) {
+                rewrite();
+                return;
+            }
+
+            // the blocks must follow each other in the log as it is now
+            uint64_t log_size = size(log);
+            TimeIndexBlock next;
+            while (file.read(reinterpret_cast<char*>(&next), sizeof(next))) {
+                if (next.offset != end() || next.rows != every || next.offset + next.size > log_size) {
+                    blocks.clear();
+                    break;
+                }
+                blocks.push_back(next);
+            }
+            full = blocks.size();
+
+            // cut short by a crash, or out of date
+            if (size(index) != sizeof(header) + full * sizeof(TimeIndexBlock)) rewrite();
+        }
+
+        void TimeIndex::rewrite() {
+            blocks.resize(full);
+
+            std::ofstream file(index, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) throw std::runtime_error("could not open " + index);
+
+            TimeIndexHeader header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, "BSNI", 4);
+            header.version = 1;
+            header.every = every;
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            if (!blocks.empty()) file.write(reinterpret_cast<const char*>(&blocks[0]), blocks.size() * sizeof(TimeIndexBlock));
+            if (!file) throw std::runtime_error("could not write " + index);
+        }
+
+        uint64_t TimeIndex::end() const {
+            return blocks.empty() ? 0 : blocks.back().offset + blocks.back().size;
+        }
+
+        void TimeIndex::update() {
+            // the lines after the full blocks are indexed again, with the new ones
+            blocks.resize(full);
+
+            std::ifstream file(log, std::ios::binary);
+            if (!file.is_open()) return;
+            file.seekg(end());
+
+            std::ofstream out;
+            TimeIndexBlock current = block(end());
+            std::string line;
+            while (std::getline(file, line)) {
+                // the last line is not whole yet
+                if (file.eof()) break;
+
+                ++current.rows;
+                current.size += line.size() + 1;
+
+                int64_t clock, timestamp;
+                if (SegmentedLog::clocks(line, clock, timestamp)) {
+                    current.min_clock = std::min(current.min_clock, clock);
+                    current.max_clock = std::max(current.max_clock, clock);
+                    current.min_timestamp = std::min(current.min_timestamp, timestamp);
+                    current.max_timestamp = std::max(current.max_timestamp, timestamp);
+                }
+
+                if (current.rows == every) {
+                    if (!out.is_open()) {
+                        out.open(index, std::ios::binary | std::ios::app);
+                        if (!out.is_open()) throw std::runtime_error("could not open " + index);
+                    }
+                    out.write(reinterpret_cast<const char*>(&current), sizeof(current));
+
+                    blocks.push_back(current);
+                    ++full;
+                    current = block(end());
+                }
+            }
+            if (out.is_open() && !out.flush()) throw std::runtime_error("could not write " + index);
+
+            if (current.rows > 0) blocks.push_back(current);
+        }
+
+        const std::vector<TimeIndexBlock> &TimeIndex::getBlocks() const {
+            return blocks;
+        }
+
+        std::vector<TimeIndexBlock> TimeIndex::find(const int64_t &from, const int64_t &to) const {
+            std::vector<TimeIndexBlock> found;
+            for (const TimeIndexBlock &block : blocks) {
+                if (block.max_timestamp >= from && block.min_timestamp <= to) found.push_back(block);
+            }
+            return found;
+        }
+
+        uint64_t TimeIndex::seek(const int64_t &clock) const {
+            // the log is in logical order
+            std::vector<TimeIndexBlock>::const_iterator it = std::lower_bound(blocks.begin(), blocks.end(), clock,
+                [](const TimeIndexBlock &block, const int64_t &clock) { return block.max_clock < clock; });
+            return it == blocks.end() ? end() : it->offset;
+        }
+    }
+}
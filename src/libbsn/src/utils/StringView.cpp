@@ -0,0 +1,9 @@
+#include "libbsn/utils/StringView.hpp"
+
+namespace bsn {
+    namespace utils {
+
+        // bound to const references (e.g. the default of substr), it needs a definition
+        const size_t StringView::npos;
+    }
+}
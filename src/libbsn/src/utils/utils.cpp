@@ -1,29 +1,143 @@
 #include "libbsn/utils/utils.hpp"
 
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <stdexcept>
+
 using namespace std;
 
 namespace bsn {
     namespace utils {
         
         const vector<string> split(const string& s, const char& c) {    
-	        string buff{""};
 	        vector<string> v;
 	
-	        for(auto n:s) {
-	    	    if(n != c) 
-                    buff+=n; 
-                else
-		            if(n == c && buff != "") { 
-                        v.push_back(buff); 
-                        buff = ""; 
-                    }
+	        for(StringView token : Tokenizer(s, c)) {
+                v.push_back(token.str());
 	        }
-	        if(buff != "") 
-                v.push_back(buff);
 	
 	        return v;
         }
 
+        bool split_once(const StringView &text, const char &delimiter, StringView &first, StringView &second) {
+            size_t position = text.find(delimiter);
+            if (position == StringView::npos) return false;
+
+            first = text.substr(0, position);
+            second = text.substr(position + 1);
+            return true;
+        }
+
+        namespace {
+            // number of characters parsed, 0 if none; error set to ERANGE on overflow
+            size_t read_double(const StringView &text, double &value, int &error) {
+                // strtod needs a terminated string, numbers fit in a small buffer
+                char buffer[128];
+                string copy;
+                const char *begin = buffer;
+
+                if (text.size() < sizeof(buffer)) {
+                    std::copy(text.begin(), text.end(), buffer);
+                    buffer[text.size()] = '\0';
+                } else {
+                    copy = text.str();
+                    begin = copy.c_str();
+                }
+
+                char *end;
+                errno = 0;
+                value = strtod(begin, &end);
+                error = errno;
+                return end - begin;
+            }
+
+            size_t read_int(const StringView &text, int32_t &value, bool &overflow) {
+                size_t i = 0;
+                while (i < text.size() && isspace(static_cast<unsigned char>(text[i]))) ++i;
+
+                bool negative = false;
+                if (i < text.size() && (text[i] == '+' || text[i] == '-')) negative = (text[i++] == '-');
+
+                size_t digits = i;
+                int64_t number = 0;
+                overflow = false;
+                for (; i < text.size() && isdigit(static_cast<unsigned char>(text[i])); ++i) {
+                    number = number * 10 + (text[i] - '0');
+                    if (number > static_cast<int64_t>(INT32_MAX) + 1) {
+                        overflow = true;
+                        number = static_cast<int64_t>(INT32_MAX) + 1;
+                    }
+                }
+                if (i == digits) return 0;
+
+                if (negative) number = -number;
+                if (number > INT32_MAX || number < INT32_MIN) overflow = true;
+
+                value = static_cast<int32_t>(number);
+                return i;
+            }
+        }
+
+        double to_double(const StringView &text) {
+            double value;
+            int error;
+
+            if (read_double(text, value, error) == 0) throw invalid_argument("to_double: no conversion");
+            if (error == ERANGE) throw out_of_range("to_double: out of range");
+            return value;
+        }
+
+        int32_t to_int(const StringView &text) {
+            int32_t value = 0;
+            bool overflow;
+
+            if (read_int(text, value, overflow) == 0) throw invalid_argument("to_int: no conversion");
+            if (overflow) throw out_of_range("to_int: out of range");
+            return value;
+        }
+
+        bool parse(const StringView &text, double &value) {
+            int error;
+            double result;
+
+            if (text.empty() || isspace(static_cast<unsigned char>(text[0]))) return false;
+            if (read_double(text, result, error) != text.size() || error == ERANGE) return false;
+
+            value = result;
+            return true;
+        }
+
+        bool parse(const StringView &text, int32_t &value) {
+            bool overflow;
+            int32_t result = 0;
+
+            if (text.empty() || isspace(static_cast<unsigned char>(text[0]))) return false;
+            if (read_int(text, result, overflow) != text.size() || overflow) return false;
+
+            value = result;
+            return true;
+        }
+
+        // nanosecond timestamps do not fit in 32 bits
+        bool parse(const StringView &text, int64_t &value) {
+            size_t i = 0;
+            bool negative = false;
+            if (i < text.size() && (text[i] == '+' || text[i] == '-')) negative = (text[i++] == '-');
+            if (i == text.size()) return false;
+
+            uint64_t limit = negative ? static_cast<uint64_t>(INT64_MAX) + 1 : INT64_MAX;
+            uint64_t number = 0;
+            for (; i < text.size(); ++i) {
+                if (!isdigit(static_cast<unsigned char>(text[i]))) return false;
+                unsigned digit = text[i] - '0';
+                if (number > (limit - digit) / 10) return false;
+                number = number * 10 + digit;
+            }
+
+            value = negative ? static_cast<int64_t>(0 - number) : static_cast<int64_t>(number);
+            return true;
+        }
+
     }
 }
-
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "libbsn/analysis/History.hpp"
+#include "libbsn/storage/SegmentedLog.hpp"
+
+using namespace bsn::analysis;
+
+class HistoryTest : public testing::Test {
+    protected:
+        std::string dir;
+
+        HistoryTest() : dir() {}
+
+        virtual void SetUp() {
+            dir = std::string(P_tmpdir);
+            TearDown();
+        }
+
+        virtual void TearDown() {
+            const char *logs[] = {"status", "energystatus"};
+            for (const char *log : logs) {
+                std::string name = std::string(log) + "_history_test";
+                std::remove((dir + "/" + name + ".log").c_str());
+                std::remove((dir + "/" + name + ".tix").c_str());
+                std::remove((dir + "/" + name + ".idx").c_str());
+                for (uint32_t i = 0; i < 10; ++i) {
+                    std::remove(bsn::storage::SegmentedLog::path(dir, name, i, "log").c_str());
+                    std::remove(bsn::storage::SegmentedLog::path(dir, name, i, "seg").c_str());
+                }
+            }
+        }
+
+        // a status of /g3t1_1 and /g3t1_2 every second for 5 minutes, /g3t1_2 fails
+        // every other one in the third minute
+        std::string status(const int64_t &i) {
+            std::string source = i % 2 ? "/g3t1_2" : "/g3t1_1";
+            bool fail = i % 2 && i / 60 == 2 && (i / 2) % 2;
+            return "Status," + std::to_string(i + 1) + "," + std::to_string(i * 1000000000) + "," + source + ",," + (fail ? "fail" : "success");
+        }
+};
+
+TEST_F(HistoryTest, Reliability) {
+    {
+        std::ofstream file(dir + "/status_history_test.log");
+        file << "\n";
+        for (int64_t i = 0; i < 300; ++i) file << status(i) << "\n";
+    }
+
+    History history(dir, "history_test");
+    std::map<std::string, std::vector<double>> minutes = history.reliability("/g3t1_2", 0, 300000000000, 60000000000);
+    ASSERT_EQ(minutes.size(), 1u);
+    const std::vector<double> &reliability = minutes["/g3t1_2"];
+    ASSERT_EQ(reliability.size(), 5u);
+    ASSERT_DOUBLE_EQ(reliability[0], 1);
+    ASSERT_DOUBLE_EQ(reliability[2], 0.5);
+    ASSERT_DOUBLE_EQ(reliability[4], 1);
+
+    // every component, past the end of the log; the last bucket is cut short
+    minutes = history.reliability("", 120000000000, 400000000000, 60000000000);
+    ASSERT_EQ(minutes.size(), 2u);
+    ASSERT_EQ(minutes["/g3t1_1"].size(), 5u);
+    ASSERT_DOUBLE_EQ(minutes["/g3t1_1"][0], 1);
+    ASSERT_DOUBLE_EQ(minutes["/g3t1_2"][0], 0.5);
+    ASSERT_TRUE(std::isnan(minutes["/g3t1_2"][4]));
+}
+
+TEST_F(HistoryTest, Cost) {
+    {
+        std::ofstream file(dir + "/energystatus_history_test.log");
+        file << "\n";
+        file << "EnergyStatus,1,1000000000,global,,2.000000\n";
+        file << "EnergyStatus,1,1000000000,g3t1_1,,0.500000\n";
+        file << "EnergyStatus,2,2000000000,global,,4.000000\n";
+        file << "EnergyStatus,3,12000000000,global,,1.000000\n";
+    }
+
+    History history(dir, "history_test");
+    std::map<std::string, std::vector<double>> costs = history.cost("", 0, 20000000000, 10000000000);
+    ASSERT_EQ(costs.size(), 2u);
+    ASSERT_DOUBLE_EQ(costs["global"][0], 3);
+    ASSERT_DOUBLE_EQ(costs["global"][1], 1);
+    ASSERT_TRUE(std::isnan(costs["g3t1_1"][1]));
+
+    // with or without the slash
+    ASSERT_EQ(history.cost("/g3t1_1", 0, 20000000000, 10000000000).size(), 1u);
+}
+
+TEST_F(HistoryTest, Segments) {
+    {
+        bsn::storage::SegmentedLog log(dir, "status_history_test", 4096, 0);
+        for (int64_t i = 0; i < 300; ++i) log.append(status(i));
+    }
+
+    History history(dir, "history_test");
+    std::map<std::string, std::vector<double>> minutes = history.reliability("/g3t1_2", 0, 300000000000, 60000000000);
+    ASSERT_EQ(minutes["/g3t1_2"].size(), 5u);
+    ASSERT_DOUBLE_EQ(minutes["/g3t1_2"][2], 0.5);
+}
+
+TEST_F(HistoryTest, Growing) {
+    std::ofstream file(dir + "/status_history_test.log");
+    file << "\n";
+    for (int64_t i = 0; i < 120; ++i) file << status(i) << "\n";
+    file.flush();
+
+    History history(dir, "history_test");
+    ASSERT_TRUE(history.reliability("/g3t1_2", 120000000000, 180000000000, 60000000000).empty());
+
+    for (int64_t i = 120; i < 180; ++i) file << status(i) << "\n";
+    file.flush();
+    ASSERT_DOUBLE_EQ(history.reliability("/g3t1_2", 120000000000, 180000000000, 60000000000)["/g3t1_2"][0], 0.5);
+}
+
+TEST_F(HistoryTest, Invalid) {
+    History history(dir, "history_test");
+    EXPECT_THROW(history.reliability("", 0, 60000000000, 60000000000), std::runtime_error);
+    EXPECT_THROW(history.reliability("", 0, 60000000000, 0), std::invalid_argument);
+    EXPECT_THROW(history.reliability("", 60000000000, 0, 1), std::invalid_argument);
+    EXPECT_THROW(history.reliability("", 0, 60000000000, 1), std::invalid_argument);
+}
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <cstdio>
+#include <fstream>
+
+#include "libbsn/analysis/LogAnalyzer.hpp"
+#include "libbsn/storage/SegmentedLog.hpp"
+
+using namespace bsn::analysis;
+
+class LogAnalyzerTest : public testing::Test {
+    protected:
+        std::string dir;
+        std::string formula;
+        // logs of an execution committed next to this file
+        std::string resources;
+
+        LogAnalyzerTest() : dir(), formula(), resources() {}
+
+        virtual void SetUp() {
+            dir = std::string(P_tmpdir);
+            std::string source = __FILE__;
+            resources = source.substr(0, source.find_last_of('/')) + "/resource";
+            formula = "CTX_G3_T1_1*F_G3_T1_1*R_G3_T1_1*CTX_G3_T1_2*F_G3_T1_2*R_G3_T1_2";
+        }
+
+        virtual void TearDown() {
+            const char *logs[] = {"status", "energystatus", "event", "adaptation"};
+            for (const char *log : logs) {
+                std::remove(path(log).c_str());
+
+                std::string name = std::string(log) + "_analyzer_segments";
+                std::remove((dir + "/" + name + ".idx").c_str());
+                for (uint32_t i = 0; i < 4; ++i) {
+                    std::remove(bsn::storage::SegmentedLog::path(dir, name, i, "log").c_str());
+                    std::remove(bsn::storage::SegmentedLog::path(dir, name, i, "seg").c_str());
+                }
+            }
+        }
+
+        std::string path(const std::string &log) {
+            return dir + "/" + log + "_analyzer_test.log";
+        }
+
+        // the first line of a file under resources
+        std::string resource(const std::string &name) {
+            std::ifstream file(resources + "/" + name);
+            std::string line;
+            if (!std::getline(file, line)) throw std::runtime_error("could not read " + resources + "/" + name);
+            return line;
+        }
+
+        // the first line is left blank, as DataAccess does
+        void write(const std::string &log, const std::string &lines) {
+            std::ofstream file(path(log));
+            file << "\n" << lines;
+        }
+};
+
+TEST_F(LogAnalyzerTest, Reliability) {
+    LogAnalyzer analyzer(formula, "reliability", 0.5);
+
+    analyzer.add("Event,1,0,/g3t1_1,,activate");
+    analyzer.add("Event,2,0,/g3t1_2,,activate");
+    analyzer.add("Status,3,1000000000,/g3t1_1,,success");
+    analyzer.add("Status,4,1000000000,/g3t1_2,,success");
+    analyzer.add("Status,5,2000000000,/g3t1_1,,success");
+    analyzer.add("Status,6,2000000000,/g3t1_2,,fail");
+
+    // one value per instant, the last one
+    const std::vector<std::pair<int64_t, double>> &curve = analyzer.getCurve();
+    ASSERT_EQ(curve.size(), 3u);
+    ASSERT_EQ(curve[0].first, 0);
+    ASSERT_EQ(curve[1].first, 1000000000);
+    ASSERT_DOUBLE_EQ(curve[1].second, 0);
+    ASSERT_EQ(curve[2].first, 2000000000);
+    ASSERT_DOUBLE_EQ(curve[2].second, 0.5);
+}
+
+TEST_F(LogAnalyzerTest, SlidingWindow) {
+    LogAnalyzer analyzer("R_G3_T1_1", "reliability", 1);
+
+    // only the statuses of the last 25 s count
+    analyzer.add("Status,1,0,/g3t1_1,,fail");
+    analyzer.add("Status,2,10000000000,/g3t1_1,,success");
+    ASSERT_DOUBLE_EQ(analyzer.getCurve().back().second, 0.5);
+    analyzer.add("Status,3,25000000000,/g3t1_1,,success");
+    ASSERT_DOUBLE_EQ(analyzer.getCurve().back().second, 1);
+
+    // out of order, the window is still the 25 s up to the last status
+    analyzer.add("Status,4,5000000000,/g3t1_1,,fail");
+    ASSERT_DOUBLE_EQ(analyzer.getCurve().back().second, 0);
+}
+
+TEST_F(LogAnalyzerTest, Deactivated) {
+    LogAnalyzer analyzer(formula, "reliability", 1);
+    analyzer.deactivate("/g3t1_2");
+
+    analyzer.add("Event,1,0,/g3t1_1,,activate");
+    analyzer.add("Status,2,0,/g3t1_2,,success");
+    analyzer.add("Event,3,0,/g3t1_2,,deactivate");
+    analyzer.add("Status,4,1000000000,/g3t1_1,,success");
+    analyzer.add("Status,5,2000000000,/g3t1_1,,success");
+
+    ASSERT_DOUBLE_EQ(analyzer.getCurve().back().second, 1);
+}
+
+TEST_F(LogAnalyzerTest, Analyze) {
+    write("status",
+        "Status,1,0,/g3t1_1,,success\n"
+        "Status,3,1000000000,/g3t1_1,,fail\n"
+        "Status,4,2000000000,/g3t1_1,,success\n"
+        "Status,5,3000000000,/g3t1_1,,success\n"
+        "Status,6,4000000000,/g3t1_1,,success\n"
+        "Status,7,5000000000,/g3t1_1,,success\n");
+    write("event", "");
+    write("adaptation", "Adaptation,2,1500000000,/enactor,/g3t1_1,freq=1\n");
+
+    LogAnalyzer analyzer("R_G3_T1_1", "reliability", 0.8);
+    analyzer.read(dir, "analyzer_test");
+
+    // 2/3, 3/4, 4/5 and 5/6 from the adaptation on, settled on the last one
+    ControlMetrics metrics = analyzer.analyze();
+    ASSERT_DOUBLE_EQ(metrics.mean, 5.0 / 6);
+    ASSERT_TRUE(metrics.stable);
+    ASSERT_DOUBLE_EQ(metrics.settling_time, 3);
+    ASSERT_NEAR(metrics.overshoot, 0, 1e-9);
+    ASSERT_NEAR(metrics.sse, 100 * (5.0 / 6 - 0.8) / 0.8, 1e-9);
+    ASSERT_NEAR(metrics.robustness, 100 * (1 - (0.8 - 2.0 / 3 + 0.05 + 0 + 5.0 / 6 - 0.8) / 4), 1e-9);
+}
+
+TEST_F(LogAnalyzerTest, Segments) {
+    {
+        // a segment every two statuses, the last one left uncompressed
+        bsn::storage::SegmentedLog status(dir, "status_analyzer_segments", 60, 0);
+        bsn::storage::SegmentedLog event(dir, "event_analyzer_segments", 0, 0);
+        bsn::storage::SegmentedLog adaptation(dir, "adaptation_analyzer_segments", 0, 0);
+        status.append("Status,1,0,/g3t1_1,,success");
+        status.append("Status,3,1000000000,/g3t1_1,,fail");
+        status.append("Status,4,2000000000,/g3t1_1,,success");
+        status.append("Status,5,3000000000,/g3t1_1,,success");
+        status.append("Status,6,4000000000,/g3t1_1,,success");
+        status.append("Status,7,5000000000,/g3t1_1,,success");
+        adaptation.append("Adaptation,2,1500000000,/enactor,/g3t1_1,freq=1");
+    }
+
+    LogAnalyzer analyzer("R_G3_T1_1", "reliability", 0.8);
+    analyzer.read(dir, "analyzer_segments");
+
+    // as the plain logs of Analyze
+    ControlMetrics metrics = analyzer.analyze();
+    ASSERT_DOUBLE_EQ(metrics.mean, 5.0 / 6);
+    ASSERT_DOUBLE_EQ(metrics.settling_time, 3);
+}
+
+TEST_F(LogAnalyzerTest, Cost) {
+    write("energystatus",
+        "EnergyStatus,1,1000000000,/g3t1_1,,0.5\n"
+        "EnergyStatus,2,1000000000,global,,2\n"
+        "EnergyStatus,4,2000000000,global,,1\n");
+    write("event", "Event,3,1500000000,/g3t1_1,,deactivate\n");
+    write("adaptation", "");
+
+    LogAnalyzer analyzer("W_G3_T1_1", "cost", 1);
+    analyzer.read(dir, "analyzer_test");
+
+    const std::vector<std::pair<int64_t, double>> &curve = analyzer.getCurve();
+    ASSERT_EQ(curve.size(), 2u);
+    ASSERT_DOUBLE_EQ(curve[0].second, 2);
+    ASSERT_DOUBLE_EQ(curve[1].second, 1);
+
+    // never adapted, nothing to analyze
+    EXPECT_THROW(analyzer.analyze(), std::runtime_error);
+}
+
+TEST_F(LogAnalyzerTest, OutOfOrder) {
+    write("status",
+        "Status,2,1000000000,/g3t1_1,,success\n"
+        "Status,1,2000000000,/g3t1_1,,success\n");
+    write("event", "");
+    write("adaptation", "");
+
+    LogAnalyzer analyzer("R_G3_T1_1", "reliability", 1);
+    EXPECT_THROW(analyzer.read(dir, "analyzer_test"), std::runtime_error);
+}
+
+// resource/*_parity.log, with the metrics simulation/analyzer/src/Analyzer.py computes for them
+TEST_F(LogAnalyzerTest, ParityReliability) {
+    LogAnalyzer analyzer(resource("reliability.formula"), "reliability", 0.9);
+    analyzer.read(resources, "parity");
+
+    ControlMetrics metrics = analyzer.analyze();
+    ASSERT_NEAR(metrics.mean, 0.8754557770820747, 1e-9);
+    ASSERT_TRUE(metrics.stable);
+    ASSERT_NEAR(metrics.settling_time, 12.028084997, 1e-9);
+    ASSERT_NEAR(metrics.overshoot, 1.1830833695991112, 1e-9);
+    ASSERT_NEAR(metrics.sse, 2.727135879769483, 1e-9);
+    ASSERT_NEAR(metrics.robustness, 85.40577368426854, 1e-9);
+}
+
+TEST_F(LogAnalyzerTest, ParityCost) {
+    LogAnalyzer analyzer(resource("cost.formula"), "cost", 1.5);
+    analyzer.read(resources, "parity");
+
+    ControlMetrics metrics = analyzer.analyze();
+    ASSERT_NEAR(metrics.mean, 2.19552025, 1e-9);
+    ASSERT_FALSE(metrics.stable);
+    ASSERT_NEAR(metrics.settling_time, 0, 1e-9);
+    ASSERT_NEAR(metrics.overshoot, 31.72818606432804, 1e-9);
+    ASSERT_NEAR(metrics.sse, 46.36801666666666, 1e-9);
+    ASSERT_NEAR(metrics.robustness, 17.875226666666688, 1e-9);
+}
+
+TEST_F(LogAnalyzerTest, InvalidMetric) {
+    EXPECT_THROW(LogAnalyzer("R_G3_T1_1", "latency", 1), std::invalid_argument);
+}
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <vector>
+
 #include "libbsn/configuration/SensorConfiguration.hpp"
 
 using namespace std;
@@ -115,4 +117,61 @@ TEST_F(ConfigurationTest, High0) {
 TEST_F(ConfigurationTest, High1) {            
     ASSERT_EQ(s.evaluateNumber(39.1), 0.66);
     ASSERT_EQ(s.evaluateNumber(43), 1.0);
-}
\ No newline at end of file
+}
+
+TEST_F(ConfigurationTest, LookupMatchesRanges) {
+    // the risk as evaluated one range after the other
+    auto reference = [&](double x) {
+        if (l.in_range(x)) return s.convertRealPercentage(s.getLowPercentage(), s.getDisplacement(l, x, "medium"));
+        if (m1.in_range(x)) return s.convertRealPercentage(s.getMidPercentage(), s.getDisplacement(m1, x, "decrescent"));
+        if (m2.in_range(x)) return s.convertRealPercentage(s.getMidPercentage(), s.getDisplacement(m2, x, "crescent"));
+        if (h1.in_range(x)) return s.convertRealPercentage(s.getHighPercentage(), s.getDisplacement(h1, x, "decrescent"));
+        if (h2.in_range(x)) return s.convertRealPercentage(s.getHighPercentage(), s.getDisplacement(h2, x, "crescent"));
+        return -1.0;
+    };
+
+    std::vector<double> values;
+    for (double x = 15; x <= 45; x += 0.01) values.push_back(x);
+    for (Range r : {l, m1, m2, h1, h2}) {
+        values.push_back(r.getLowerBound());
+        values.push_back(r.getUpperBound());
+    }
+
+    std::vector<double> risks(values.size());
+    s.evaluateNumbers(values.data(), risks.data(), values.size());
+
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(reference(values[i]), s.evaluateNumber(values[i])) << values[i];
+        ASSERT_EQ(reference(values[i]), risks[i]) << values[i];
+    }
+}
+
+TEST_F(ConfigurationTest, SharedBoundGoesToFirstRange) {
+    // 35 ends the first medium range and starts the low one
+    l.setLowerBound(35);
+    s.setLowRisk(l);
+
+    ASSERT_EQ(s.evaluateNumber(35), 0.2);
+    ASSERT_EQ(s.label(35), "low");
+    ASSERT_EQ(s.label(34.9), "moderate");
+}
+
+TEST_F(ConfigurationTest, Label) {
+    ASSERT_EQ(s.label(37), "low");
+    ASSERT_EQ(s.label(33), "moderate");
+    ASSERT_EQ(s.label(39), "moderate");
+    ASSERT_EQ(s.label(20), "high");
+    ASSERT_EQ(s.label(43), "high");
+    ASSERT_EQ(s.label(32.5), "unknown");
+    ASSERT_EQ(s.label(1.0/0.0), "unknown");
+    ASSERT_EQ(s.evaluateNumber(-1.0/0.0), -1);
+}
+
+TEST_F(ConfigurationTest, CopyKeepsLookup) {
+    SensorConfiguration copy(s);
+    SensorConfiguration assigned;
+    assigned = s;
+
+    ASSERT_EQ(copy.evaluateNumber(36.75), 0.1);
+    ASSERT_EQ(assigned.evaluateNumber(36.75), 0.1);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "libbsn/control/StatusWindow.hpp"
+#include "libbsn/control/ReliabilityPlanner.hpp"
+#include "libbsn/control/ProportionalController.hpp"
+#include "libbsn/model/Formula.hpp"
+
+using namespace bsn::control;
+
+class ControlTest : public testing::Test {
+    protected:
+        ControlTest() : model(), strategy(), priority(), deactivated() {}
+
+        virtual void SetUp() {
+            model = bsn::model::Formula("CTX_G3_T1_1*F_G3_T1_1*R_G3_T1_1*CTX_G3_T1_2*F_G3_T1_2*R_G3_T1_2*CTX_G4_T1*F_G4_T1*R_G4_T1");
+            for (const std::string &term : model.getTerms()) {
+                strategy[term] = 1;
+                if (term.find("R_") != std::string::npos) priority[term] = 50;
+            }
+        }
+
+        virtual void TearDown() {}
+
+        double evaluate() {
+            model.setTermValueMap(strategy);
+            return model.evaluate();
+        }
+
+        bsn::model::Formula model;
+        std::map<std::string, double> strategy;
+        std::map<std::string, int> priority;
+        std::map<std::string, int> deactivated;
+};
+
+TEST_F(ControlTest, StatusWindowReliability) {
+    StatusWindow window;
+    ASSERT_EQ(window.reliability(), 0);
+
+    window.push(0, "success");
+    window.push(1, "fail");
+    window.push(2, "0.5");
+    window.push(5, "success");
+    window.push(9, "success");
+
+    ASSERT_EQ(window.getStatuses().size(), 5u);
+    ASSERT_EQ(window.reliability(), 0.75);
+}
+
+TEST_F(ControlTest, StatusWindowSlide) {
+    StatusWindow window(10);
+    window.push(0, "fail");
+    window.push(1, "fail");
+    window.push(5, "success");
+
+    window.slide(11);
+    ASSERT_EQ(window.getStatuses().size(), 1u);
+    ASSERT_EQ(window.reliability(), 1);
+
+    window.slide(15);
+    ASSERT_TRUE(window.getStatuses().empty());
+}
+
+TEST_F(ControlTest, Off) {
+    ReliabilityPlanner planner(0.9, 0.5, 0.01);
+
+    ASSERT_FALSE(planner.off(0.9));
+    ASSERT_FALSE(planner.off(0.89));
+    ASSERT_TRUE(planner.off(0.8));
+    ASSERT_TRUE(planner.off(0.95));
+}
+
+TEST_F(ControlTest, PlanUp) {
+    ReliabilityPlanner planner(0.9, 0.5, 0.01);
+    strategy["R_G3_T1_1"] = 0.8;
+    strategy["R_G3_T1_2"] = 0.9;
+
+    ASSERT_TRUE(planner.plan(model, strategy, priority, deactivated));
+    ASSERT_NEAR(evaluate(), 0.9, 0.9*0.02);
+}
+
+TEST_F(ControlTest, PlanDown) {
+    ReliabilityPlanner planner(0.5, 0.5, 0.01);
+
+    ASSERT_TRUE(planner.plan(model, strategy, priority, deactivated));
+    ASSERT_NEAR(evaluate(), 0.5, 0.5*0.02);
+}
+
+TEST_F(ControlTest, PlanSkipsDeactivated) {
+    ReliabilityPlanner planner(0.9, 0.5, 0.01);
+    strategy["R_G3_T1_1"] = 0.5;
+    strategy["R_G3_T1_2"] = 0.9;
+    deactivated["R_G3_T1_1"] = 1;
+
+    planner.plan(model, strategy, priority, deactivated);
+    ASSERT_EQ(strategy["R_G3_T1_1"], 1);
+}
+
+TEST_F(ControlTest, Prioritize) {
+    ASSERT_TRUE(prioritize(priority, "R_G3_T1_1", 1));
+    ASSERT_EQ(priority["R_G3_T1_1"], 51);
+
+    priority["R_G3_T1_1"] = 99;
+    prioritize(priority, "R_G3_T1_1", 1);
+    ASSERT_EQ(priority["R_G3_T1_1"], 100);
+
+    priority["R_G3_T1_1"] = 1;
+    prioritize(priority, "R_G3_T1_1", -1);
+    ASSERT_EQ(priority["R_G3_T1_1"], 0);
+
+    ASSERT_FALSE(prioritize(priority, "R_G3_T1_9", 1));
+    ASSERT_EQ(priority.count("R_G3_T1_9"), 0u);
+}
+
+TEST_F(ControlTest, StepFrequency) {
+    ProportionalController controller(0.1, 40, 0.02);
+    double freq = 10;
+    int replicate = 1, exceptions = 0;
+
+    ControlAction action = controller.step(false, false, 0.9, 0.8, 200, freq, replicate, exceptions);
+    ASSERT_EQ(action.command, ControlAction::FREQ);
+    ASSERT_NEAR(action.value, 10.2, 1e-9);
+    ASSERT_NEAR(freq, 10.2, 1e-9);
+    ASSERT_EQ(exceptions, 1);
+
+    // out of bounds, the frequency is kept
+    freq = 39.9;
+    action = controller.step(false, false, 0.9, 0.8, 200, freq, replicate, exceptions);
+    ASSERT_EQ(action.command, ControlAction::NONE);
+    ASSERT_EQ(freq, 39.9);
+}
+
+TEST_F(ControlTest, StepHub) {
+    ProportionalController controller(0.1, 40, 0.02);
+    double freq = 39.9;
+    int replicate = 1, exceptions = 0;
+
+    ControlAction action = controller.step(true, false, 0.9, 0.8, 200, freq, replicate, exceptions);
+    ASSERT_EQ(action.command, ControlAction::FREQ);
+    ASSERT_NEAR(freq, 40.1, 1e-9);
+}
+
+TEST_F(ControlTest, StepReplicateCollect) {
+    ProportionalController controller(0.1, 40, 0.02);
+    double freq = 10;
+    int replicate = 1, exceptions = 0;
+
+    ControlAction action = controller.step(false, true, 0.9, 0.8, 20, freq, replicate, exceptions);
+    ASSERT_EQ(action.command, ControlAction::REPLICATE_COLLECT);
+    ASSERT_EQ(replicate, 3);
+    ASSERT_EQ(action.value, 3);
+    ASSERT_EQ(freq, 10);
+
+    action = controller.step(false, true, 0.5, 0.9, 20, freq, replicate, exceptions);
+    ASSERT_EQ(replicate, 1);
+}
+
+TEST_F(ControlTest, StepException) {
+    ProportionalController controller(0.1, 40, 0.02);
+    double freq = 10;
+    int replicate = 1, exceptions = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(controller.step(false, false, 0.9, 0.8, 0, freq, replicate, exceptions).exception, 0);
+    }
+    ASSERT_EQ(controller.step(false, false, 0.9, 0.8, 0, freq, replicate, exceptions).exception, 1);
+    ASSERT_EQ(exceptions, 0);
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "libbsn/filters/MovingAverage.hpp"
+#include "libbsn/filters/ExponentialMovingAverage.hpp"
+#include "libbsn/filters/MovingMedian.hpp"
+
+#include <cmath>
 
 using namespace std;
 using namespace bsn::filters;
@@ -61,3 +65,80 @@ TEST_F(FiltersTest, AverageWithMoreValues) {
 
     ASSERT_EQ(filter.getValue(), 35.4);
 }
+
+TEST_F(FiltersTest, BufferAfterWrapping) {
+    MovingAverage filter(3);
+
+    for (int i = 1; i <= 7; ++i) filter.insert(i);
+
+    ASSERT_EQ(filter.getBuffer(), vector<double>({5, 6, 7}));
+    ASSERT_EQ(filter.getValue(), 6.0);
+}
+
+TEST_F(FiltersTest, AverageDoesNotDrift) {
+    MovingAverage filter(10);
+
+    for (int i = 0; i < 1000000; ++i) filter.insert((i % 2) ? 1e8 : 0.1);
+    for (int i = 0; i < 10; ++i) filter.insert(0.1);
+
+    ASSERT_NEAR(filter.getValue(), 0.1, 1e-9);
+}
+
+TEST_F(FiltersTest, ShrinkRangeKeepsNewestValues) {
+    MovingAverage filter(5);
+
+    for (int i = 1; i <= 5; ++i) filter.insert(i);
+    filter.setRange(2);
+
+    ASSERT_EQ(filter.getRange(), 2u);
+    ASSERT_EQ(filter.getValue(), 4.5);
+}
+
+TEST_F(FiltersTest, ExponentialAverage) {
+    ExponentialMovingAverage filter(3);
+
+    filter.insert(10);
+    ASSERT_EQ(filter.getValue(), 10.0);
+
+    filter.insert(20);
+    ASSERT_EQ(filter.getAlpha(), 0.5);
+    ASSERT_EQ(filter.getValue(), 15.0);
+}
+
+TEST_F(FiltersTest, MedianIgnoresOutliers) {
+    MovingMedian filter(5);
+
+    filter.insert(36.0);
+    filter.insert(36.5);
+    filter.insert(200.0);
+    filter.insert(37.0);
+    filter.insert(36.8);
+
+    ASSERT_EQ(filter.getValue(), 36.8);
+}
+
+TEST_F(FiltersTest, MedianOfEvenWindow) {
+    MovingMedian filter(4);
+
+    for (int i = 1; i <= 6; ++i) filter.insert(i);
+
+    ASSERT_EQ(filter.getValue(), 4.5);
+}
+
+TEST_F(FiltersTest, MedianDropsNaN) {
+    MovingMedian filter(2);
+
+    filter.insert(1);
+    filter.insert(std::nan(""));
+    filter.insert(3);
+    filter.insert(std::nan(""));
+    filter.insert(5);
+
+    ASSERT_EQ(filter.getValue(), 4.0);
+}
+
+TEST_F(FiltersTest, MakeFilter) {
+    ASSERT_EQ(make_filter("moving_average", 4)->getRange(), 4u);
+    ASSERT_EQ(make_filter("median", 3)->getRange(), 3u);
+    ASSERT_THROW(make_filter("kalman", 3), std::invalid_argument);
+}
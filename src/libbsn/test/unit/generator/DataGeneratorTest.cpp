@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <stdint.h>
 #include <stdexcept>
+#include <vector>
 
 #include "libbsn/generator/DataGenerator.hpp"
 #include "libbsn/generator/Markov.hpp"
@@ -11,8 +12,8 @@ using namespace bsn::generator;
 
 class DataGeneratorTest : public testing::Test {
     protected:
-        std::array<float,25> transitions;
-        std::array<Range, 5> states;
+        std::vector<double> transitions;
+        std::vector<Range> states;
         Markov mk;
 
         DataGeneratorTest() : transitions(), states(), mk() {}
@@ -26,9 +27,7 @@ class DataGeneratorTest : public testing::Test {
                 100,0,0,0,0}};
 
             states = {{Range(1, 3), Range(4, 6), Range(7, 9), Range(10, 11), Range(12, 13)}};
-            mk.transitions = transitions;
-            mk.states = states;
-            mk.currentState = 4;
+            mk = Markov(transitions, states, 4);
         }
 };
 
@@ -46,7 +45,7 @@ TEST_F(DataGeneratorTest, GetValue) {
 }
 
 TEST_F(DataGeneratorTest, GetValueWithWrongCurrentState) {
-    mk.currentState = 3;
+    mk.setCurrentState(3);
     int wrong_state = 4;
     DataGenerator dg(mk);
     
@@ -56,7 +55,7 @@ TEST_F(DataGeneratorTest, GetValueWithWrongCurrentState) {
 }
 
 TEST_F(DataGeneratorTest, GetValueWithOutOfBoundsState) {
-    mk.currentState = 10;
+    mk.setCurrentState(10);
     DataGenerator dg(mk);
     
     try{
@@ -88,7 +87,7 @@ TEST_F(DataGeneratorTest, NextButSameState) {
                 0,0,0,100,0,
                 0,0,0,0,100,
                 0,0,0,0,100}};
-    mk.transitions = transitions;
+    mk = Markov(transitions, states, 4);
     DataGenerator dg(mk);
     
     dg.nextState();
@@ -96,4 +95,36 @@ TEST_F(DataGeneratorTest, NextButSameState) {
 
     //should generate a value from state 0 (the next state according to transition matrix)
     ASSERT_TRUE(states[4].getLowerBound() <= x && x <= states[4].getUpperBound());
-}
\ No newline at end of file
+}
+
+TEST_F(DataGeneratorTest, GenerateMatchesSequentialCalls) {
+    transitions = {{
+                50,50,0,0,0,
+                0,50,50,0,0,
+                0,0,50,50,0,
+                0,0,0,50,50,
+                50,0,0,0,50}};
+    mk = Markov(transitions, states, 0);
+    DataGenerator sequential(mk), bulk(mk);
+    sequential.setSeed(7);
+    bulk.setSeed(7);
+
+    std::vector<double> expected;
+    for (int i = 0; i < 600; i++) {
+        if (i % 3 == 0) sequential.nextState();
+        expected.push_back(sequential.getValue());
+    }
+
+    std::vector<double> values(600);
+    bulk.generate(values.size(), values.data(), 3);
+
+    ASSERT_EQ(expected, values);
+    ASSERT_EQ(sequential.getValue(), bulk.getValue());
+}
+
+TEST_F(DataGeneratorTest, GenerateWithZeroPeriod) {
+    DataGenerator dg(mk);
+    double x;
+
+    ASSERT_THROW(dg.generate(1, &x, 0), std::invalid_argument);
+}
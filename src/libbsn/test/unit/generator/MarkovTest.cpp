@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <vector>
+
+#include "libbsn/generator/Markov.hpp"
+#include "libbsn/random/Philox.hpp"
+#include "libbsn/range/Range.hpp"
+
+using namespace bsn::range;
+using namespace bsn::generator;
+
+class MarkovTest : public testing::Test {
+    protected:
+        std::vector<double> transitions;
+        std::vector<Range> states;
+        bsn::random::Philox rng;
+
+        MarkovTest() : transitions(), states(), rng(42) {}
+
+        virtual void SetUp() {
+            transitions = {
+                70,20,10,
+                10,80,10,
+                5,15,80};
+
+            states = {Range(0, 1), Range(1, 2), Range(2, 3)};
+        }
+};
+
+TEST_F(MarkovTest, WrongMatrixSize) {
+    transitions.pop_back();
+
+    ASSERT_THROW(Markov(transitions, states, 0), std::invalid_argument);
+}
+
+TEST_F(MarkovTest, NegativeProbability) {
+    transitions[1] = -20;
+
+    ASSERT_THROW(Markov(transitions, states, 0), std::invalid_argument);
+}
+
+TEST_F(MarkovTest, FrequenciesMatchTransitions) {
+    Markov mk(transitions, states, 0);
+    const size_t n = 300000;
+    std::vector<int32_t> path(n);
+
+    int32_t previous = mk.getCurrentState();
+    mk.generate(n, path.data(), rng);
+
+    std::vector<double> counts(9, 0), visits(3, 0);
+    for (size_t i = 0; i < n; i++) {
+        counts[previous*3 + path[i]]++;
+        visits[previous]++;
+        previous = path[i];
+    }
+
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            ASSERT_NEAR(transitions[i*3 + j] / 100, counts[i*3 + j] / visits[i], 0.01);
+        }
+    }
+}
+
+TEST_F(MarkovTest, RemainderStaysInState) {
+    // the second row only adds up to 40%
+    transitions = {
+        0,100,0,
+        0,10,30,
+        0,0,0};
+    Markov mk(transitions, states, 1);
+
+    std::vector<int32_t> path(100000);
+    double stays = 0;
+    for (size_t i = 0; i < path.size(); i++) {
+        mk.setCurrentState(1);
+        mk.next_state(rng.uniform());
+        if (mk.getCurrentState() == 1) stays++;
+        ASSERT_NE(0, mk.getCurrentState());
+    }
+    ASSERT_NEAR(0.7, stays / path.size(), 0.01);
+
+    // a row of zeros never leaves its state
+    mk.setCurrentState(2);
+    mk.generate(path.size(), path.data(), rng);
+    for (int32_t state : path) ASSERT_EQ(2, state);
+}
+
+TEST_F(MarkovTest, ManyStates) {
+    const size_t n = 64;
+    transitions.assign(n * n, 0);
+    states.clear();
+    for (size_t i = 0; i < n; i++) {
+        transitions[i*n + (i + 1) % n] = 100;
+        states.push_back(Range(i, i + 1));
+    }
+    Markov mk(transitions, states, 0);
+
+    for (size_t i = 1; i <= 2 * n; i++) {
+        mk.next_state(rng.uniform());
+        ASSERT_EQ(static_cast<int32_t>(i % n), mk.getCurrentState());
+
+        double x = mk.calculate_state(rng.uniform());
+        ASSERT_TRUE(states[i % n].getLowerBound() <= x && x < states[i % n].getUpperBound());
+    }
+}
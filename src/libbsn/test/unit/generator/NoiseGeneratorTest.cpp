@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "libbsn/generator/NoiseGenerator.hpp"
+
+using namespace bsn::generator;
+
+class NoiseGeneratorTest : public testing::Test {
+    protected:
+        NoiseGeneratorTest() {}
+
+        virtual void SetUp() {}
+};
+
+TEST_F(NoiseGeneratorTest, NoNoise) {
+    NoiseGenerator noise(1);
+
+    ASSERT_EQ(noise.apply(36.5, 0), 36.5);
+    ASSERT_EQ(noise.replicate(36.5, 0, 200), 36.5);
+}
+
+TEST_F(NoiseGeneratorTest, ReplicaWithinBounds) {
+    NoiseGenerator noise(1);
+
+    for (int i = 0; i < 1000; ++i) {
+        double offset = std::fabs(noise.apply(100, 0.1) - 100);
+        ASSERT_GE(offset, 10.0 - 1e-9);
+        ASSERT_LE(offset, 20.0 + 1e-9);
+    }
+}
+
+TEST_F(NoiseGeneratorTest, ReplicasAverageOut) {
+    NoiseGenerator noise(1);
+
+    ASSERT_NEAR(noise.replicate(100, 0.1, 100000), 100, 0.5);
+}
+
+TEST_F(NoiseGeneratorTest, SameSeedSameNoise) {
+    NoiseGenerator a(3), b(3);
+
+    ASSERT_EQ(a.replicate(50, 0.2, 17), b.replicate(50, 0.2, 17));
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+
+#include "libbsn/generator/TraceWriter.hpp"
+#include "libbsn/generator/TraceReader.hpp"
+
+using namespace bsn::generator;
+
+class TraceTest : public testing::Test {
+    protected:
+        std::string path;
+        std::vector<std::string> channels;
+
+        TraceTest() : path(), channels() {}
+
+        virtual void SetUp() {
+            path = std::string(P_tmpdir) + "/bsn_trace_test.bin";
+            channels = {"oxigenation", "heart_rate", "temperature"};
+        }
+
+        virtual void TearDown() {
+            std::remove(path.c_str());
+        }
+};
+
+TEST_F(TraceTest, WriteAndRead) {
+    {
+        TraceWriter writer(path, channels, 1000);
+        for (int i = 0; i < 100; i++) {
+            writer.append({97.5 + i, 80.0, 36.5});
+        }
+        ASSERT_EQ(writer.getSamples(), 100u);
+    }
+
+    TraceReader reader(path);
+
+    ASSERT_EQ(reader.getChannels(), channels);
+    ASSERT_EQ(reader.getFrequency(), 1000);
+    ASSERT_EQ(reader.getSamples(), 100u);
+    ASSERT_FLOAT_EQ(reader.at(0, 0), 97.5);
+    ASSERT_FLOAT_EQ(reader.at(99, 0), 196.5);
+    ASSERT_FLOAT_EQ(reader.at(42, 2), 36.5);
+    ASSERT_FLOAT_EQ(reader.row(42)[1], 80.0);
+}
+
+TEST_F(TraceTest, ChannelIndex) {
+    {
+        TraceWriter writer(path, channels, 10);
+    }
+
+    TraceReader reader(path);
+
+    ASSERT_EQ(reader.getChannelIndex("heart_rate"), 1u);
+    EXPECT_THROW(reader.getChannelIndex("glucose"), std::out_of_range);
+}
+
+TEST_F(TraceTest, OutOfBounds) {
+    {
+        TraceWriter writer(path, channels, 10);
+        writer.append({1, 2, 3});
+    }
+
+    TraceReader reader(path);
+
+    EXPECT_THROW(reader.at(1, 0), std::out_of_range);
+    EXPECT_THROW(reader.at(0, 3), std::out_of_range);
+}
+
+TEST_F(TraceTest, RowWithWrongSize) {
+    TraceWriter writer(path, channels, 10);
+
+    EXPECT_THROW(writer.append({1, 2}), std::invalid_argument);
+}
+
+TEST_F(TraceTest, NotATraceFile) {
+    {
+        std::ofstream file(path);
+        file << "Name,logical_clock,timestamp,source,target,content" << std::endl;
+    }
+
+    EXPECT_THROW(TraceReader reader(path), std::invalid_argument);
+}
+
+
+TEST_F(TraceTest, SamplesBeyondFile) {
+    {
+        TraceWriter writer(path, channels, 10);
+        writer.append({1, 2, 3});
+    }
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        uint64_t samples = UINT64_MAX / 2;
+        file.seekp(offsetof(TraceHeader, samples));
+        file.write(reinterpret_cast<const char*>(&samples), sizeof(samples));
+    }
+
+    EXPECT_THROW(TraceReader reader(path), std::invalid_argument);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "libbsn/random/Philox.hpp"
+#include "libbsn/random/Seed.hpp"
+
+using namespace bsn::random;
+
+class PhiloxTest : public testing::Test {
+    protected:
+        PhiloxTest() {}
+
+        virtual void SetUp() {}
+};
+
+// known answer of Philox4x32-10 for a zero key and counter (Random123)
+TEST_F(PhiloxTest, KnownAnswer) {
+    Philox rng(0, 0);
+
+    ASSERT_EQ(rng.next(), 0x6627e8d5u);
+    ASSERT_EQ(rng.next(), 0xe169c58du);
+    ASSERT_EQ(rng.next(), 0xbc57ac4cu);
+    ASSERT_EQ(rng.next(), 0x9b00dbd8u);
+}
+
+TEST_F(PhiloxTest, StreamsDiffer) {
+    Philox a(1, 0), b(1, 1);
+
+    ASSERT_NE(a.next(), b.next());
+}
+
+TEST_F(PhiloxTest, SeekIsRandomAccess) {
+    Philox a(5, 2), b(5, 2);
+
+    for (int i = 0; i < 4 * 10; ++i) a.next();
+    b.seek(10);
+
+    ASSERT_EQ(a.next(), b.next());
+}
+
+TEST_F(PhiloxTest, FillMatchesSequentialDraws) {
+    Philox a(9), b(9);
+    std::vector<double> bulk(37);
+
+    a.fill(bulk.data(), bulk.size());
+    for (double v : bulk) ASSERT_EQ(v, b.uniform());
+}
+
+TEST_F(PhiloxTest, BulkWordsMatchSequentialDraws) {
+    Philox a(9, 4), b(9, 4);
+    std::vector<uint32_t> bulk(70);
+
+    a.fill(bulk.data(), bulk.size());
+    for (uint32_t v : bulk) ASSERT_EQ(v, b.next());
+}
+
+TEST_F(PhiloxTest, UniformIntWithinBounds) {
+    Philox rng(3);
+
+    for (int i = 0; i < 10000; ++i) {
+        int32_t v = rng.uniform_int(1, 100);
+        ASSERT_GE(v, 1);
+        ASSERT_LE(v, 100);
+    }
+}
+
+TEST_F(PhiloxTest, SeedForIsStable) {
+    ASSERT_EQ(seed_for(42, "/g3t1_1"), seed_for(42, "/g3t1_1"));
+    ASSERT_NE(seed_for(42, "/g3t1_1"), seed_for(42, "/g3t1_2"));
+    ASSERT_EQ(stream_id(""), 0xcbf29ce484222325ULL);
+}
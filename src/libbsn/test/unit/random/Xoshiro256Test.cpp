@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "libbsn/random/Xoshiro256.hpp"
+
+using namespace bsn::random;
+
+class Xoshiro256Test : public testing::Test {
+    protected:
+        Xoshiro256Test() {}
+
+        virtual void SetUp() {}
+};
+
+TEST_F(Xoshiro256Test, SameSeedSameSequence) {
+    Xoshiro256 a(42), b(42);
+
+    for (int i = 0; i < 100; ++i) ASSERT_EQ(a.next(), b.next());
+}
+
+TEST_F(Xoshiro256Test, DifferentSeedsDiffer) {
+    Xoshiro256 a(1), b(2);
+
+    ASSERT_NE(a.next(), b.next());
+}
+
+TEST_F(Xoshiro256Test, UniformWithinBounds) {
+    Xoshiro256 rng(7);
+    std::vector<double> values(10000);
+    double sum = 0;
+
+    rng.fill(values.data(), values.size());
+    for (double v : values) {
+        ASSERT_GE(v, 0.0);
+        ASSERT_LT(v, 1.0);
+        sum += v;
+    }
+
+    ASSERT_NEAR(sum / values.size(), 0.5, 0.02);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <cstdio>
+#include <fstream>
+
+#include "libbsn/storage/ColumnWriter.hpp"
+#include "libbsn/storage/ColumnReader.hpp"
+
+using namespace bsn::storage;
+
+class ColumnTest : public testing::Test {
+    protected:
+        std::string path;
+
+        ColumnTest() : path() {}
+
+        virtual void SetUp() {
+            path = std::string(P_tmpdir) + "/bsn_column_test.col";
+        }
+
+        virtual void TearDown() {
+            std::remove(path.c_str());
+        }
+
+        // a status log of the six sensors and the central hub
+        void write(const uint32_t &rows, const uint32_t &block_rows) {
+            ColumnWriter writer(path, block_rows);
+            for (uint32_t i = 0; i < rows; ++i) {
+                writer.append("Status", i + 1, 1600000000000000000 + 100000000 * int64_t(i),
+                              "/g3t1_" + std::to_string(i % 7), "", i % 10 ? "success" : "fail");
+            }
+            ASSERT_EQ(writer.getRows(), rows);
+        }
+};
+
+TEST_F(ColumnTest, WriteAndRead) {
+    write(10000, 4096);
+
+    ColumnReader reader(path);
+    ASSERT_EQ(reader.getRows(), 10000u);
+    ASSERT_EQ(reader.getBlocks(), 3u);
+    ASSERT_EQ(reader.getBlock(0).rows, 4096u);
+    ASSERT_EQ(reader.getBlock(2).min_clock, 8193);
+    ASSERT_EQ(reader.getBlock(2).max_clock, 10000);
+
+    std::vector<int64_t> clocks, timestamps;
+    reader.read(LOGICAL_CLOCK, clocks);
+    reader.read(TIMESTAMP, timestamps);
+    std::vector<std::string> names, sources, targets, contents;
+    reader.read(NAME, names);
+    reader.read(SOURCE, sources);
+    reader.read(TARGET, targets);
+    reader.read(CONTENT, contents);
+
+    ASSERT_EQ(clocks.size(), 10000u);
+    ASSERT_EQ(contents.size(), 10000u);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        ASSERT_EQ(clocks[i], i + 1);
+        ASSERT_EQ(timestamps[i], 1600000000000000000 + 100000000 * int64_t(i));
+        ASSERT_EQ(names[i], "Status");
+        ASSERT_EQ(sources[i], "/g3t1_" + std::to_string(i % 7));
+        ASSERT_EQ(targets[i], "");
+        ASSERT_EQ(contents[i], i % 10 ? "success" : "fail");
+    }
+}
+
+TEST_F(ColumnTest, Codes) {
+    write(100, 4096);
+
+    ColumnReader reader(path);
+    std::vector<uint32_t> codes;
+    std::vector<std::string> dictionary;
+    reader.read(0, CONTENT, codes, dictionary);
+
+    ASSERT_EQ(dictionary.size(), 2u);
+    ASSERT_EQ(dictionary[codes[0]], "fail");
+    ASSERT_EQ(dictionary[codes[1]], "success");
+    ASSERT_EQ(codes.size(), 100u);
+}
+
+TEST_F(ColumnTest, Deltas) {
+    {
+        ColumnWriter writer(path);
+        writer.append("Event", 5, 300, "/g4t1", "", "activate");
+        writer.append("Event", 3, -200, "/g4t1", "", "deactivate");
+        writer.append("Event", INT64_MAX, INT64_MIN, "/g4t1", "", "activate");
+    }
+
+    ColumnReader reader(path);
+    std::vector<int64_t> clocks, timestamps;
+    reader.read(LOGICAL_CLOCK, clocks);
+    reader.read(TIMESTAMP, timestamps);
+
+    ASSERT_EQ(clocks, std::vector<int64_t>({5, 3, INT64_MAX}));
+    ASSERT_EQ(timestamps, std::vector<int64_t>({300, -200, INT64_MIN}));
+    ASSERT_EQ(reader.getBlock(0).min_timestamp, INT64_MIN);
+    ASSERT_EQ(reader.getBlock(0).max_clock, INT64_MAX);
+}
+
+TEST_F(ColumnTest, Smaller) {
+    write(10000, 4096);
+
+    // each column of a block is a fraction of the text log
+    ColumnReader reader(path);
+    uint64_t text = 10000 * std::string("Status,10000,1600000000000000000,/g3t1_0,,success\n").size();
+    uint64_t content = 0, file = 0;
+    for (size_t i = 0; i < reader.getBlocks(); ++i) {
+        content += reader.getBlock(i).sizes[CONTENT];
+        for (int column = 0; column < COLUMNS; ++column) {
+            file += reader.getBlock(i).sizes[column];
+        }
+    }
+
+    ASSERT_LT(content * 100, text);
+    ASSERT_LT(file * 5, text);
+}
+
+TEST_F(ColumnTest, TruncatedBlock) {
+    write(5000, 4096);
+
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size() - 10);
+    out.close();
+
+    ColumnReader reader(path);
+    ASSERT_EQ(reader.getBlocks(), 1u);
+    ASSERT_EQ(reader.getRows(), 4096u);
+}
+
+TEST_F(ColumnTest, WrongColumn) {
+    write(10, 4096);
+
+    ColumnReader reader(path);
+    std::vector<int64_t> numbers;
+    std::vector<std::string> strings;
+    EXPECT_THROW(reader.read(0, SOURCE, numbers), std::invalid_argument);
+    EXPECT_THROW(reader.read(0, TIMESTAMP, strings), std::invalid_argument);
+    EXPECT_THROW(reader.read(1, SOURCE, strings), std::out_of_range);
+}
+
+TEST_F(ColumnTest, NotAColumnFile) {
+    {
+        std::ofstream out(path);
+        out << "\nStatus,1,1600000000000000000,/g3t1_1,,success\n";
+    }
+
+    EXPECT_THROW(ColumnReader reader(path), std::invalid_argument);
+}
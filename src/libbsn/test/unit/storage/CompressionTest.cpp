@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+
+#include "libbsn/storage/Compression.hpp"
+
+using namespace bsn::storage;
+
+class CompressionTest : public testing::Test {
+    protected:
+        CompressionTest() {}
+
+        std::string roundtrip(const std::string &text) {
+            std::string packed;
+            compress(text.data(), text.size(), packed);
+
+            std::string unpacked(text.size(), '\0');
+            decompress(packed.data(), packed.size(), &unpacked[0], unpacked.size());
+            return unpacked;
+        }
+};
+
+TEST_F(CompressionTest, Log) {
+    std::string log;
+    for (int i = 0; i < 2000; ++i) {
+        log += "Status," + std::to_string(i) + "," + std::to_string(1610549979516318295 + 100000000 * int64_t(i)) + ",/g3t1_" + std::to_string(i % 6 + 1) + ",," + (i % 9 ? "success" : "fail") + "\n";
+    }
+
+    std::string packed;
+    compress(log.data(), log.size(), packed);
+
+    ASSERT_LT(packed.size() * 3, log.size());
+    ASSERT_EQ(roundtrip(log), log);
+}
+
+TEST_F(CompressionTest, Short) {
+    ASSERT_EQ(roundtrip(""), "");
+    ASSERT_EQ(roundtrip("a"), "a");
+    ASSERT_EQ(roundtrip("aaaaaaaaaaaaa"), "aaaaaaaaaaaaa");
+    ASSERT_EQ(roundtrip(std::string(1000, 'x')), std::string(1000, 'x'));
+}
+
+TEST_F(CompressionTest, Random) {
+    std::string text;
+    uint32_t state = 1;
+    for (int i = 0; i < 100000; ++i) {
+        state = state * 1103515245 + 12345;
+        text += static_cast<char>(state >> 24);
+    }
+
+    ASSERT_EQ(roundtrip(text), text);
+}
+
+TEST_F(CompressionTest, Corrupt) {
+    std::string text(1000, 'x');
+    std::string packed;
+    compress(text.data(), text.size(), packed);
+
+    std::string out(text.size(), '\0');
+    EXPECT_THROW(decompress(packed.data(), packed.size() - 1, &out[0], out.size()), std::invalid_argument);
+    EXPECT_THROW(decompress(packed.data(), packed.size(), &out[0], out.size() - 1), std::invalid_argument);
+
+    // a match before the start of the block
+    const char bad[] = {0x10, 'x', 0x05, 0x00};
+    EXPECT_THROW(decompress(bad, sizeof(bad), &out[0], 10), std::invalid_argument);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <cstdio>
+#include <fstream>
+
+#include "libbsn/storage/SegmentedLog.hpp"
+#include "libbsn/storage/SegmentReader.hpp"
+
+using namespace bsn::storage;
+
+class SegmentTest : public testing::Test {
+    protected:
+        std::string dir;
+        std::string name;
+
+        SegmentTest() : dir(), name() {}
+
+        virtual void SetUp() {
+            dir = std::string(P_tmpdir);
+            name = "bsn_segment_test";
+            TearDown();
+        }
+
+        virtual void TearDown() {
+            std::remove((dir + "/" + name + ".idx").c_str());
+            for (uint32_t i = 0; i < 100; ++i) {
+                std::remove(SegmentedLog::path(dir, name, i, "log").c_str());
+                std::remove(SegmentedLog::path(dir, name, i, "seg").c_str());
+            }
+        }
+
+        std::string line(const int64_t &i) {
+            return "Status," + std::to_string(i) + "," + std::to_string(1000 * i) + ",/g3t1_" + std::to_string(i % 6 + 1) + ",," + (i % 9 ? "success" : "fail");
+        }
+
+        uint64_t size(const std::string &path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            return file.is_open() ? static_cast<uint64_t>(file.tellg()) : 0;
+        }
+};
+
+TEST_F(SegmentTest, Rotate) {
+    {
+        SegmentedLog log(dir, name, 100000, 0);
+        for (int64_t i = 0; i < 10000; ++i) {
+            log.append(line(i));
+        }
+    }
+
+    SegmentReader reader(dir, name);
+    const std::vector<SegmentIndex> &segments = reader.getSegments();
+    ASSERT_GT(segments.size(), 3u);
+
+    uint64_t rows = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        ASSERT_EQ(segments[i].segment, i);
+        ASSERT_EQ(segments[i].min_clock, static_cast<int64_t>(rows));
+        rows += segments[i].rows;
+        ASSERT_EQ(segments[i].max_timestamp, 1000 * static_cast<int64_t>(rows - 1));
+
+        // compressed, and the plain one is gone
+        ASSERT_LT(size(SegmentedLog::path(dir, name, i, "seg")) * 3, 100000u);
+        ASSERT_EQ(size(SegmentedLog::path(dir, name, i, "log")), 0u);
+    }
+    ASSERT_EQ(rows, 10000u);
+
+    std::string text;
+    for (int64_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(reader.next(text));
+        ASSERT_EQ(text, line(i));
+    }
+    ASSERT_FALSE(reader.next(text));
+}
+
+TEST_F(SegmentTest, Seek) {
+    {
+        SegmentedLog log(dir, name, 100000, 0);
+        for (int64_t i = 0; i < 10000; ++i) {
+            log.append(line(i));
+        }
+    }
+
+    SegmentReader reader(dir, name);
+    reader.seek(5000000, 5999000);
+
+    std::string text;
+    for (int64_t i = 5000; i < 6000; ++i) {
+        ASSERT_TRUE(reader.next(text));
+        ASSERT_EQ(text, line(i));
+    }
+    ASSERT_FALSE(reader.next(text));
+}
+
+TEST_F(SegmentTest, Plain) {
+    SegmentedLog log(dir, name, 0, 0);
+    for (int64_t i = 0; i < 100; ++i) {
+        log.append(line(i));
+    }
+    log.flush();
+
+    // the current segment is read as it is
+    ASSERT_TRUE(SegmentReader::exists(dir, name));
+    SegmentReader reader(dir, name);
+    ASSERT_TRUE(reader.getSegments().empty());
+
+    std::string text;
+    for (int64_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(reader.next(text));
+        ASSERT_EQ(text, line(i));
+    }
+    ASSERT_FALSE(reader.next(text));
+
+    log.rotate();
+    log.append(line(100));
+    log.close();
+
+    SegmentReader closed(dir, name);
+    ASSERT_EQ(closed.getSegments().size(), 2u);
+    ASSERT_EQ(closed.getSegments()[1].rows, 1u);
+}
+
+TEST_F(SegmentTest, NoSegments) {
+    ASSERT_FALSE(SegmentReader::exists(dir, name));
+
+    SegmentReader reader(dir, name);
+    std::string text;
+    ASSERT_FALSE(reader.next(text));
+}
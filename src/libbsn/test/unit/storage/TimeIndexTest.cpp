@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <cstdio>
+#include <fstream>
+
+#include "libbsn/storage/TimeIndex.hpp"
+
+using namespace bsn::storage;
+
+class TimeIndexTest : public testing::Test {
+    protected:
+        std::string log;
+        std::string index;
+
+        TimeIndexTest() : log(), index() {}
+
+        virtual void SetUp() {
+            log = std::string(P_tmpdir) + "/bsn_time_index_test.log";
+            index = std::string(P_tmpdir) + "/bsn_time_index_test.tix";
+            TearDown();
+        }
+
+        virtual void TearDown() {
+            std::remove(log.c_str());
+            std::remove(index.c_str());
+        }
+
+        // lines [first, last), 1 s apart, after the blank first line
+        void write(const int64_t &first, const int64_t &last) {
+            std::ofstream file(log, std::ios::app);
+            if (first == 1) file << "\n";
+            for (int64_t i = first; i < last; ++i) {
+                file << "Status," << i << "," << i * 1000000000 << ",/g3t1_1,,success\n";
+            }
+        }
+};
+
+TEST_F(TimeIndexTest, Blocks) {
+    write(1, 25);
+
+    TimeIndex time_index(log, index, 10);
+    time_index.update();
+
+    // the blank line, then 24 lines: two full blocks and 5 lines after them
+    const std::vector<TimeIndexBlock> &blocks = time_index.getBlocks();
+    ASSERT_EQ(blocks.size(), 3u);
+    ASSERT_EQ(blocks[0].offset, 0u);
+    ASSERT_EQ(blocks[0].min_clock, 1);
+    ASSERT_EQ(blocks[0].max_clock, 9);
+    ASSERT_EQ(blocks[1].offset, blocks[0].size);
+    ASSERT_EQ(blocks[1].min_timestamp, 10000000000);
+    ASSERT_EQ(blocks[1].max_timestamp, 19000000000);
+    ASSERT_EQ(blocks[2].rows, 5u);
+
+    std::ifstream file(log);
+    file.seekg(blocks[2].offset);
+    std::string line;
+    std::getline(file, line);
+    ASSERT_EQ(line, "Status,20,20000000000,/g3t1_1,,success");
+}
+
+TEST_F(TimeIndexTest, Find) {
+    write(1, 41);
+
+    TimeIndex time_index(log, index, 10);
+    time_index.update();
+
+    std::vector<TimeIndexBlock> found = time_index.find(12000000000, 25000000000);
+    ASSERT_EQ(found.size(), 2u);
+    ASSERT_EQ(found[0].min_clock, 10);
+    ASSERT_EQ(found[1].max_clock, 29);
+
+    ASSERT_TRUE(time_index.find(50000000000, 60000000000).empty());
+
+    ASSERT_EQ(time_index.seek(15), time_index.getBlocks()[1].offset);
+    // past the last line, the end of the log
+    ASSERT_EQ(time_index.seek(100), time_index.getBlocks().back().offset + time_index.getBlocks().back().size);
+}
+
+TEST_F(TimeIndexTest, Follow) {
+    write(1, 15);
+    {
+        std::ofstream file(log, std::ios::app);
+        file << "Status,15,15000000000,/g3t1_1"; // not whole yet
+    }
+
+    TimeIndex time_index(log, index, 10);
+    time_index.update();
+    ASSERT_EQ(time_index.getBlocks().size(), 2u);
+    ASSERT_EQ(time_index.getBlocks()[1].max_clock, 14);
+
+    {
+        std::ofstream file(log, std::ios::app);
+        file << ",,success\n";
+    }
+    write(16, 25);
+    time_index.update();
+    ASSERT_EQ(time_index.getBlocks().size(), 3u);
+    ASSERT_EQ(time_index.getBlocks()[1].max_clock, 19);
+    ASSERT_EQ(time_index.getBlocks()[2].max_clock, 24);
+
+    // the full blocks are kept, a new index reads them back
+    TimeIndex reopened(log, index, 10);
+    ASSERT_EQ(reopened.getBlocks().size(), 2u);
+    reopened.update();
+    ASSERT_EQ(reopened.getBlocks().size(), 3u);
+    ASSERT_EQ(reopened.getBlocks()[2].offset, time_index.getBlocks()[2].offset);
+}
+
+TEST_F(TimeIndexTest, Rebuild) {
+    write(1, 25);
+    {
+        TimeIndex time_index(log, index, 10);
+        time_index.update();
+    }
+
+    // a new log under the same name, shorter than the blocks indexed
+    TearDown();
+    write(1, 5);
+
+    TimeIndex time_index(log, index, 10);
+    ASSERT_TRUE(time_index.getBlocks().empty());
+    time_index.update();
+    ASSERT_EQ(time_index.getBlocks().size(), 1u);
+    ASSERT_EQ(time_index.getBlocks()[0].max_clock, 4);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "libbsn/utils/utils.hpp"
+
+using namespace bsn::utils;
+
+class UtilsTest : public testing::Test {
+    protected:
+        std::vector<std::string> tokens(const std::string &text, const char &delimiter) {
+            std::vector<std::string> v;
+            for (StringView token : Tokenizer(text, delimiter)) v.push_back(token.str());
+            return v;
+        }
+};
+
+TEST_F(UtilsTest, TokenizerSkipsEmptyTokens) {
+    std::vector<std::string> expected = {"a", "bc", "d"};
+
+    ASSERT_EQ(expected, tokens(",,a,bc,,d,", ','));
+    ASSERT_EQ(expected, split(",,a,bc,,d,", ','));
+    ASSERT_TRUE(tokens("", ',').empty());
+    ASSERT_TRUE(tokens(",,,", ',').empty());
+    ASSERT_EQ(std::vector<std::string>{"abc"}, tokens("abc", ','));
+}
+
+TEST_F(UtilsTest, TokensViewTheText) {
+    std::string text = "/g3t1_1:success;/g4t1:fail";
+    Tokenizer tokenizer(text, ';');
+    Tokenizer::iterator it = tokenizer.begin();
+
+    ASSERT_EQ(text.data(), it->data());
+    ASSERT_EQ(StringView("/g3t1_1:success"), *it++);
+    ASSERT_EQ("/g4t1:fail", *it);
+    ASSERT_TRUE(++it == tokenizer.end());
+}
+
+TEST_F(UtilsTest, SplitOnce) {
+    StringView first, second;
+
+    ASSERT_TRUE(split_once("/g3t1_1:success,fail", ':', first, second));
+    ASSERT_EQ("/g3t1_1", first);
+    ASSERT_EQ("success,fail", second);
+
+    ASSERT_TRUE(split_once("freq=", '=', first, second));
+    ASSERT_EQ("freq", first);
+    ASSERT_TRUE(second.empty());
+
+    ASSERT_FALSE(split_once("freq", '=', first, second));
+}
+
+TEST_F(UtilsTest, ToDoubleAsStod) {
+    for (std::string text : {"0.75", "-3", " 12.5", "1e3", "2.5abc", "0.1", "inf"}) {
+        ASSERT_EQ(std::stod(text), to_double(text)) << text;
+    }
+
+    // views are not terminated, the number must stop at the end of the view
+    std::string text = "12345";
+    ASSERT_EQ(12, to_double(StringView(text.data(), 2)));
+
+    ASSERT_THROW(to_double(""), std::invalid_argument);
+    ASSERT_THROW(to_double("abc"), std::invalid_argument);
+    ASSERT_THROW(to_double("1e999"), std::out_of_range);
+}
+
+TEST_F(UtilsTest, ToIntAsStoi) {
+    for (std::string text : {"0", "-15", "+7", " 42", "3.9", "2147483647", "-2147483648"}) {
+        ASSERT_EQ(std::stoi(text), to_int(text)) << text;
+    }
+
+    std::string text = "12345";
+    ASSERT_EQ(123, to_int(StringView(text.data(), 3)));
+
+    ASSERT_THROW(to_int(""), std::invalid_argument);
+    ASSERT_THROW(to_int("-"), std::invalid_argument);
+    ASSERT_THROW(to_int("2147483648"), std::out_of_range);
+    ASSERT_THROW(to_int("99999999999999999999"), std::out_of_range);
+}
+
+TEST_F(UtilsTest, StrictParse) {
+    double d = 0;
+    int32_t i = 0;
+
+    ASSERT_TRUE(parse("0.25", d));
+    ASSERT_EQ(0.25, d);
+    ASSERT_FALSE(parse("0.25x", d));
+    ASSERT_FALSE(parse(" 1", d));
+    ASSERT_FALSE(parse("", d));
+    ASSERT_EQ(0.25, d);
+
+    ASSERT_TRUE(parse("-12", i));
+    ASSERT_EQ(-12, i);
+    ASSERT_FALSE(parse("1.5", i));
+    ASSERT_FALSE(parse("4294967296", i));
+    ASSERT_EQ(-12, i);
+
+    int64_t l = 0;
+    ASSERT_TRUE(parse("1610549979516318295", l));
+    ASSERT_EQ(1610549979516318295, l);
+    ASSERT_TRUE(parse("-9223372036854775808", l));
+    ASSERT_EQ(INT64_MIN, l);
+    ASSERT_FALSE(parse("9223372036854775808", l));
+    ASSERT_FALSE(parse("-", l));
+    ASSERT_FALSE(parse(" 1", l));
+    ASSERT_EQ(INT64_MIN, l);
+}
@@ -2,8 +2,13 @@
 #include "libbsn/generator/DataGenerator.hpp"
 #include "libbsn/utils/utils.hpp"
 #include "libbsn/range/Range.hpp"
+#include "libbsn/random/Seed.hpp"
 #include <string>
+#include <memory>
+#include "libbsn/generator/TraceWriter.hpp"
+#include "libbsn/generator/TraceReader.hpp"
 #include "services/PatientData.h"
+#include "messages/VitalSigns.h"
 #include <ros/console.h>
 
 #include "archlib/ROSComponent.hpp"
@@ -21,13 +26,32 @@ class PatientModule : public arch::ROSComponent {
         bool getPatientData(services::PatientData::Request &request, services::PatientData::Response &response);
         bsn::generator::DataGenerator configureDataGenerator(const std::string& vitalSign);
 
+        void publishVitalSigns();
+        void advanceStates(const double &elapsed);
+        double sample(const std::string &vitalSign);
+        void recordTrace(const std::string &path, const double &duration);
+
+        std::vector<std::string> vitalSigns;
         std::map<std::string, bsn::generator::DataGenerator> patientData;
         std::map<std::string, double> vitalSignsFrequencies;
         std::map<std::string, double> vitalSignsChanges;
         std::map<std::string, double> vitalSignsOffsets;
+        // seed of the run, each vital sign draws from its own stream of it
+        uint64_t seed;
+
+        // live, record or replay
+        std::string mode;
+        std::unique_ptr<bsn::generator::TraceReader> trace;
+        std::map<std::string, uint32_t> traceChannels;
+        double tracePosition;
+        double traceStep; // trace samples per second of patient time
 
         double frequency;
         double period;
+        double streamPeriod;
+        ros::Time lastStream;
+        ros::Time lastTick;
         ros::NodeHandle nh;
         ros::ServiceServer service;
+        ros::Publisher vitalSignsPub;
 };
\ No newline at end of file
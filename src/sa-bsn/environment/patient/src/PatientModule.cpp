@@ -1,14 +1,17 @@
 #include <PatientModule.hpp>
 
-PatientModule::PatientModule(int  &argc, char **argv, std::string name) : ROSComponent(argc, argv, name) {}
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+PatientModule::PatientModule(int  &argc, char **argv, std::string name) : ROSComponent(argc, argv, name), seed(0), mode("live"), trace(), traceChannels(), tracePosition(0), traceStep(0), streamPeriod(0), lastStream(), lastTick() {}
 
 PatientModule::~PatientModule() {}
 
 void PatientModule::setUp() {
-    srand(time(NULL));
-
     // TODO change Operation to static
     std::string vitalSigns;
+    double streamFrequency = 0;
     service = nh.advertiseService("getPatientData", &PatientModule::getPatientData, this);
     double aux;
 
@@ -21,6 +24,7 @@ void PatientModule::setUp() {
     vitalSigns.erase(std::remove(vitalSigns.begin(), vitalSigns.end(),' '), vitalSigns.end());
 
     std::vector<std::string> splittedVitalSigns = bsn::utils::split(vitalSigns, ',');
+    this->vitalSigns = splittedVitalSigns;
 
     for (std::string s : splittedVitalSigns) {
         vitalSignsFrequencies[s] = 0;
@@ -29,6 +33,10 @@ void PatientModule::setUp() {
         nh.getParam(s + "_Offset", vitalSignsOffsets[s]);
     }
 
+    // the same seed gives the same patient, unset it for a different one every run
+    int seedParam;
+    seed = nh.getParam("seed", seedParam) ? static_cast<uint64_t>(seedParam) : bsn::random::random_seed();
+
     for (const std::string& s : splittedVitalSigns) {
         patientData[s] = configureDataGenerator(s);
     }
@@ -36,25 +44,99 @@ void PatientModule::setUp() {
     rosComponentDescriptor.setFreq(frequency);
     
     period = 1/frequency;
+
+    // Publishes all vital signs at once every 1/streamFrequency seconds, so that
+    // sensors do not need one getPatientData call per sample (0 disables it)
+    nh.getParam("streamFrequency", streamFrequency);
+    if (streamFrequency > 0) {
+        streamPeriod = 1/streamFrequency;
+        vitalSignsPub = nh.advertise<messages::VitalSigns>("vital_signs", 10);
+    }
+
+    // live: values are generated on demand by the markov chains
+    // record: generates traceDuration seconds of vital signs into traceFile, unless it is
+    //         already there or overwriteTrace is set, then replays it
+    // replay: replays traceFile, speedup times faster than it was recorded
+    nh.getParam("mode", mode);
+    if (mode == "record" || mode == "replay") {
+        std::string traceFile;
+        double speedup = 1;
+
+        nh.getParam("traceFile", traceFile);
+        nh.getParam("speedup", speedup);
+
+        try {
+            if (mode == "record") {
+                double traceDuration = 0;
+                bool overwriteTrace = false;
+                nh.getParam("traceDuration", traceDuration);
+                nh.getParam("overwriteTrace", overwriteTrace);
+
+                if (overwriteTrace || !std::ifstream(traceFile).good()) {
+                    recordTrace(traceFile, traceDuration);
+                } else {
+                    ROS_INFO("Trace %s already recorded, set overwriteTrace to record it again", traceFile.c_str());
+                }
+            }
+
+            trace.reset(new bsn::generator::TraceReader(traceFile));
+            if (trace->getSamples() == 0) throw std::runtime_error(traceFile + " is empty");
+
+            for (const std::string &s : splittedVitalSigns) {
+                traceChannels[s] = trace->getChannelIndex(s);
+            }
+        } catch (const std::exception &e) {
+            ROS_ERROR("%s, generating vital signs live", e.what());
+            trace.reset();
+            traceChannels.clear();
+            return;
+        }
+
+        tracePosition = 0;
+        traceStep = speedup * trace->getFrequency();
+        ROS_INFO("Replaying %lu samples from %s", (unsigned long) trace->getSamples(), traceFile.c_str());
+    }
+}
+
+void PatientModule::recordTrace(const std::string &path, const double &duration) {
+    bsn::generator::TraceWriter writer(path, vitalSigns, frequency);
+    std::vector<double> row(vitalSigns.size());
+    uint64_t samples = duration * frequency;
+
+    for (uint64_t i = 0; i < samples; ++i) {
+        advanceStates(period);
+        for (size_t j = 0; j < vitalSigns.size(); ++j) {
+            row[j] = patientData[vitalSigns[j]].getValue();
+        }
+        writer.append(row);
+    }
+
+    writer.close();
+    ROS_INFO("Recorded %lu samples to %s", (unsigned long) samples, path.c_str());
+}
+
+double PatientModule::sample(const std::string &vitalSign) {
+    if (!trace) return patientData[vitalSign].getValue();
+
+    std::map<std::string, uint32_t>::const_iterator channel = traceChannels.find(vitalSign);
+    if (channel == traceChannels.end()) return 0;
+
+    return trace->at(static_cast<uint64_t>(tracePosition), channel->second);
 }
 
 bsn::generator::DataGenerator PatientModule::configureDataGenerator(const std::string& vitalSign) {
-    srand(time(NULL));
-    
     std::vector<std::string> t_probs;
-    std::array<float, 25> transitions;
-    std::array<bsn::range::Range,5> ranges;
+    std::vector<double> transitions;
+    std::vector<bsn::range::Range> ranges(5);
     std::string s;
     ros::NodeHandle handle;
 
     // std::cout << vitalSign << std::endl;
-    for(uint32_t i = 0; i < transitions.size(); i++){
-        for(uint32_t j = 0; j < 5; j++){
-            handle.getParam(vitalSign + "_State" + std::to_string(j), s);
-            t_probs = bsn::utils::split(s, ',');
-            for(uint32_t k = 0; k < 5; k++){
-                transitions[i++] = std::stod(t_probs[k]);
-            }
+    for(uint32_t j = 0; j < ranges.size(); j++){
+        handle.getParam(vitalSign + "_State" + std::to_string(j), s);
+        t_probs = bsn::utils::split(s, ',');
+        for(uint32_t k = 0; k < ranges.size(); k++){
+            transitions.push_back(std::stod(t_probs[k]));
         }
     }
     
@@ -79,7 +161,7 @@ bsn::generator::DataGenerator PatientModule::configureDataGenerator(const std::s
 
     bsn::generator::Markov markov(transitions, ranges, 2);
     bsn::generator::DataGenerator dataGenerator(markov);
-    dataGenerator.setSeed();
+    dataGenerator.setSeed(bsn::random::seed_for(seed, vitalSign));
 
     return dataGenerator;
 }
@@ -89,24 +171,65 @@ void PatientModule::tearDown() {}
 bool PatientModule::getPatientData(services::PatientData::Request &request, 
                                 services::PatientData::Response &response) {
     
-    response.data = patientData[request.vitalSign].getValue();
-    
-    std::cout << "Send " + request.vitalSign + " data." << std::endl;
+    if (!request.vitalSign.empty()) {
+        response.data = sample(request.vitalSign);
+    }
+
+    // batched request: one value per requested vital sign, in the same order
+    response.values.reserve(request.vitalSigns.size());
+    for (const std::string &vitalSign : request.vitalSigns) {
+        response.values.push_back(sample(vitalSign));
+    }
+
+    ROS_DEBUG("Send %s data.", request.vitalSigns.empty() ? request.vitalSign.c_str() : "batched");
 
     return true;
 }
 
-void PatientModule::body() {
+void PatientModule::publishVitalSigns() {
+    messages::VitalSigns::Ptr msg(new messages::VitalSigns);
+
+    msg->header.stamp = ros::Time::now();
+    msg->vitalSigns = vitalSigns;
+    msg->data.reserve(vitalSigns.size());
+    for (const std::string &vitalSign : vitalSigns) {
+        msg->data.push_back(sample(vitalSign));
+    }
+
+    vitalSignsPub.publish(msg);
+}
+
+void PatientModule::advanceStates(const double &elapsed) {
     for (auto &p : vitalSignsFrequencies) {
         
         if (p.second >= (vitalSignsChanges[p.first] + vitalSignsOffsets[p.first])) {
             patientData[p.first].nextState();
             p.second = vitalSignsOffsets[p.first];
-            std::cout << "Changed " + p.first + " state." << std::endl;
+            ROS_DEBUG("Changed %s state.", p.first.c_str());
         } else {
-            p.second += period;
+            p.second += elapsed;
         }
         
     }
 }
 
+void PatientModule::body() {
+    // advances by the time actually elapsed (simulated time under /use_sim_time),
+    // so that skipped cycles do not slow down the patient
+    ros::Time now = ros::Time::now();
+    double elapsed = lastTick.isZero() ? period : (now - lastTick).toSec();
+    lastTick = now;
+
+    if (trace) {
+        // loops over the trace when it reaches its end
+        tracePosition = std::fmod(tracePosition + traceStep * elapsed, static_cast<double>(trace->getSamples()));
+    } else {
+        advanceStates(elapsed);
+    }
+
+    if (streamPeriod > 0 && (now - lastStream).toSec() >= streamPeriod) {
+        lastStream = now;
+        publishVitalSigns();
+    }
+}
+
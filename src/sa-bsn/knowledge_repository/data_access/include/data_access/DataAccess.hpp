@@ -3,11 +3,16 @@
 
 #include <fstream>
 #include <chrono>
+#include <cmath>
 #include <deque>
+#include <memory>
+#include <signal.h>
 
 #include "ros/ros.h"
 #include <ros/package.h>
 
+#include "libbsn/analysis/History.hpp"
+#include "libbsn/control/StatusWindow.hpp"
 #include "libbsn/goalmodel/Node.hpp"
 #include "libbsn/goalmodel/Goal.hpp"
 #include "libbsn/goalmodel/Task.hpp"
@@ -16,6 +21,8 @@
 #include "libbsn/goalmodel/Context.hpp"
 #include "libbsn/goalmodel/GoalTree.hpp"
 #include "libbsn/model/Formula.hpp"
+#include "libbsn/storage/ColumnWriter.hpp"
+#include "libbsn/storage/SegmentedLog.hpp"
 #include "libbsn/utils/utils.hpp"
 
 #include "archlib/Persist.h"
@@ -42,7 +49,10 @@ class DataAccess : public arch::ROSComponent {
 		DataAccess(const DataAccess &);
 		DataAccess &operator=(const DataAccess &);
 		int64_t now() const;
-		std::chrono::high_resolution_clock::time_point nowInSeconds() const;
+		ros::Time nowInSeconds() const;
+
+		// ends the loop, so that tearDown writes what is still buffered
+		static void sigIntHandler(int signal);
 
 		void persistEvent(const int64_t &timestamp, const std::string &source, const std::string &target, const std::string &content);
 		void persistStatus(const int64_t &timestamp, const std::string &source, const std::string &target, const std::string &content);
@@ -50,6 +60,11 @@ class DataAccess : public arch::ROSComponent {
 		void persistUncertainty(const int64_t &timestamp, const std::string &source, const std::string &target, const std::string &content);
 		void persistAdaptation(const int64_t &timestamp, const std::string &source, const std::string &target, const std::string &content);
 
+		void openLog(const std::string &filepath, const std::shared_ptr<bsn::storage::SegmentedLog> &segments);
+		void writeLine(const std::shared_ptr<bsn::storage::SegmentedLog> &segments, const std::shared_ptr<bsn::storage::ColumnWriter> &columns,
+					   const std::string &name, const int64_t &logical_clock, const int64_t &timestamp,
+					   const std::string &source, const std::string &target, const std::string &content);
+		void closeLog(const std::shared_ptr<bsn::storage::SegmentedLog> &segments);
 		void flush();
 
 		//double calculateCost();
@@ -85,7 +100,27 @@ class DataAccess : public arch::ROSComponent {
 		std::string uncertainty_filepath;
 		std::string adaptation_filepath;
 
+		// the logs in compressed segments instead, with segment_size or segment_period set
+		std::shared_ptr<bsn::storage::SegmentedLog> status_segments;
+		std::shared_ptr<bsn::storage::SegmentedLog> energy_status_segments;
+		std::shared_ptr<bsn::storage::SegmentedLog> event_segments;
+		std::shared_ptr<bsn::storage::SegmentedLog> uncertainty_segments;
+		std::shared_ptr<bsn::storage::SegmentedLog> adaptation_segments;
+
+		// columnar copies of the logs, with the columnar parameter set
+		std::shared_ptr<bsn::storage::ColumnWriter> status_columns;
+		std::shared_ptr<bsn::storage::ColumnWriter> energy_status_columns;
+		std::shared_ptr<bsn::storage::ColumnWriter> event_columns;
+		std::shared_ptr<bsn::storage::ColumnWriter> uncertainty_columns;
+		std::shared_ptr<bsn::storage::ColumnWriter> adaptation_columns;
+
+		// queries over the persisted logs, timed by the newest timestamp logged
+		std::shared_ptr<bsn::analysis::History> history;
+
 		int64_t logical_clock;
+		int64_t last_timestamp;
+		// trace of the newest status, handed to the engine with the data it asks for
+		std::string last_trace;
 
 		std::vector<StatusMessage> statusVec;
 		std::vector<EnergyStatusMessage> energystatusVec;
@@ -93,7 +128,7 @@ class DataAccess : public arch::ROSComponent {
 		std::vector<UncertaintyMessage> uncertainVec;
 		std::vector<AdaptationMessage> adaptVec;
 
-		std::map<std::string, std::deque<std::pair<std::chrono::high_resolution_clock::time_point, std::string>>> status;
+		std::map<std::string, bsn::control::StatusWindow> status;
 		std::map<std::string, std::deque<std::string>> events;
 		int buffer_size;
 
@@ -106,8 +141,8 @@ class DataAccess : public arch::ROSComponent {
 		std::string cost_formula;
 
 		double frequency;
-		int32_t count_to_calc_and_reset;
-		int32_t count_to_fetch;
+		ros::Time last_calc_and_reset;
+		ros::Time last_fetch;
 		int32_t arrived_status;
 };
 
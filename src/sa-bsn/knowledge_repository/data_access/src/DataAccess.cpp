@@ -2,15 +2,21 @@
 
 #define W(x) std::cerr << #x << " = " << x << std::endl;
 
-DataAccess::DataAccess(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), fp(), event_filepath(), status_filepath(), logical_clock(0), statusVec(), eventVec(), status(), buffer_size(), reliability_formula(), cost_formula() {}
+DataAccess::DataAccess(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), fp(), event_filepath(), status_filepath(), logical_clock(0), last_timestamp(0), last_trace(), statusVec(), eventVec(), status(), buffer_size(), reliability_formula(), cost_formula() {}
 DataAccess::~DataAccess() {}
 
 int64_t DataAccess::now() const{
     return std::chrono::high_resolution_clock::now().time_since_epoch().count();
 }
 
-std::chrono::high_resolution_clock::time_point DataAccess::nowInSeconds() const {
-    return std::chrono::high_resolution_clock::now();
+// follows /clock when /use_sim_time is set
+ros::Time DataAccess::nowInSeconds() const {
+    return ros::Time::now();
+}
+
+// as the default handler of ros, only flags the shutdown
+void DataAccess::sigIntHandler(int signal) {
+    ros::requestShutdown();
 }
 
 std::string fetch_formula(std::string name){
@@ -37,33 +43,86 @@ void DataAccess::setUp() {
     std::string url;
     std::string now = std::to_string(this->now());
 
-    event_filepath = path + "/../resource/logs/event_" + now + ".log";
-    status_filepath = path + "/../resource/logs/status_" + now + ".log";
-    energy_status_filepath = path + "/../resource/logs/energystatus_" + now + ".log";
-    uncertainty_filepath = path + "/../resource/logs/uncertainty_" + now + ".log";
-    adaptation_filepath = path + "/../resource/logs/adaptation_" + now + ".log";
+    // experiments running side by side each log to their own directory
+    std::string log_dir = path + "/../resource/logs";
+    getParam("log_dir", log_dir);
+
+    event_filepath = log_dir + "/event_" + now + ".log";
+    status_filepath = log_dir + "/status_" + now + ".log";
+    energy_status_filepath = log_dir + "/energystatus_" + now + ".log";
+    uncertainty_filepath = log_dir + "/uncertainty_" + now + ".log";
+    adaptation_filepath = log_dir + "/adaptation_" + now + ".log";
+
+    // for 24/7 operation, logs are written in segments rotated every segment_size bytes
+    // or segment_period seconds, compressed in the background
+    int segment_size = 0;
+    double segment_period = 0;
+    getParam("segment_size", segment_size);
+    getParam("segment_period", segment_period);
+
+    if (segment_size > 0 || segment_period > 0) {
+        try {
+            status_segments.reset(new bsn::storage::SegmentedLog(log_dir, "status_" + now, segment_size, segment_period));
+            energy_status_segments.reset(new bsn::storage::SegmentedLog(log_dir, "energystatus_" + now, segment_size, segment_period));
+            event_segments.reset(new bsn::storage::SegmentedLog(log_dir, "event_" + now, segment_size, segment_period));
+            uncertainty_segments.reset(new bsn::storage::SegmentedLog(log_dir, "uncertainty_" + now, segment_size, segment_period));
+            adaptation_segments.reset(new bsn::storage::SegmentedLog(log_dir, "adaptation_" + now, segment_size, segment_period));
+        } catch (const std::exception &e) {
+            ROS_ERROR("%s, logging without segments", e.what());
+            status_segments.reset();
+            energy_status_segments.reset();
+            event_segments.reset();
+            uncertainty_segments.reset();
+            adaptation_segments.reset();
+        }
+    }
 
-    fp.open(event_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
-    fp << "\n";
-    fp.close();
+    if (!status_segments) {
+        fp.open(event_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
+        fp << "\n";
+        fp.close();
 
-    fp.open(status_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
-    fp << "\n";
-    fp.close();
+        fp.open(status_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
+        fp << "\n";
+        fp.close();
 
-    fp.open(energy_status_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
-    fp << "\n";
-    fp.close();
+        fp.open(energy_status_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
+        fp << "\n";
+        fp.close();
 
-    fp.open(uncertainty_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
-    fp << "\n";
-    fp.close();
+        fp.open(uncertainty_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
+        fp << "\n";
+        fp.close();
 
-    fp.open(adaptation_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
-    fp << "\n";
-    fp.close();
+        fp.open(adaptation_filepath, std::fstream::in | std::fstream::out | std::fstream::trunc);
+        fp << "\n";
+        fp.close();
+    }
+
+    // time-range queries over everything logged so far, rather than the last seconds kept in memory
+    history.reset(new bsn::analysis::History(log_dir, now));
+
+    // for offline analytics, every log is also written column by column to <log>_<id>.col
+    bool columnar = false;
+    getParam("columnar", columnar);
+    if (columnar) {
+        try {
+            status_columns.reset(new bsn::storage::ColumnWriter(log_dir + "/status_" + now + ".col"));
+            energy_status_columns.reset(new bsn::storage::ColumnWriter(log_dir + "/energystatus_" + now + ".col"));
+            event_columns.reset(new bsn::storage::ColumnWriter(log_dir + "/event_" + now + ".col"));
+            uncertainty_columns.reset(new bsn::storage::ColumnWriter(log_dir + "/uncertainty_" + now + ".col"));
+            adaptation_columns.reset(new bsn::storage::ColumnWriter(log_dir + "/adaptation_" + now + ".col"));
+        } catch (const std::exception &e) {
+            ROS_ERROR("%s, logging to text only", e.what());
+            status_columns.reset();
+            energy_status_columns.reset();
+            event_columns.reset();
+            uncertainty_columns.reset();
+            adaptation_columns.reset();
+        }
+    }
 
-	handle.getParam("frequency", frequency);
+	getParam("frequency", frequency);
     rosComponentDescriptor.setFreq(frequency);
 
     buffer_size = 1000;
@@ -71,7 +130,8 @@ void DataAccess::setUp() {
     reliability_formula = fetch_formula("reliability");
     cost_formula = fetch_formula("cost");
     
-    count_to_calc_and_reset = 0;
+    last_calc_and_reset = nowInSeconds();
+    last_fetch = nowInSeconds();
     arrived_status = 0;
 
     components_batteries["g3t1_1"] = 100;
@@ -102,9 +162,25 @@ void DataAccess::setUp() {
     handle_persist = handle.subscribe("persist", 1000, &DataAccess::receivePersistMessage, this);
     server = handle.advertiseService("DataAccessRequest", &DataAccess::processQuery, this);
     targetSystemSub = handle.subscribe("TargetSystemData", 100, &DataAccess::processTargetSystemData, this);
+
+    signal(SIGINT, sigIntHandler);
 }
 
-void DataAccess::tearDown(){}
+void DataAccess::tearDown(){
+    flush();
+
+    // closing the segments waits for their compression, the columnar logs write their last, partial, blocks
+    status_segments.reset();
+    energy_status_segments.reset();
+    event_segments.reset();
+    uncertainty_segments.reset();
+    adaptation_segments.reset();
+    status_columns.reset();
+    energy_status_columns.reset();
+    event_columns.reset();
+    uncertainty_columns.reset();
+    adaptation_columns.reset();
+}
 
 void DataAccess::processTargetSystemData(const messages::TargetSystemData::ConstPtr& msg) {
     components_batteries["g3t1_1"] = msg->trm_batt;
@@ -116,24 +192,25 @@ void DataAccess::processTargetSystemData(const messages::TargetSystemData::Const
 }
 
 void DataAccess::body() {
-    count_to_fetch++;
-    count_to_calc_and_reset++;
+    ros::Time now = nowInSeconds();
     frequency = rosComponentDescriptor.getFreq();
 
-    if (count_to_calc_and_reset >= frequency) {
+    // measured in elapsed time rather than cycles, so it also holds when
+    // the simulated clock jumps over several cycles at once
+    if ((now - last_calc_and_reset).toSec() >= 1.0) {
         applyTimeWindow();
         for (auto component : status) {
             calculateComponentReliability(component.first);
         }
 
-        count_to_calc_and_reset = 0;
+        last_calc_and_reset = now;
     }
 
-    if (count_to_fetch >= frequency*10){
+    if ((now - last_fetch).toSec() >= 10.0){
         reliability_formula = fetch_formula("reliability");
         cost_formula = fetch_formula("cost");
 
-        count_to_fetch = 0;
+        last_fetch = now;
     }
 
     ros::spinOnce();
@@ -142,11 +219,14 @@ void DataAccess::body() {
 void DataAccess::receivePersistMessage(const archlib::Persist::ConstPtr& msg) {
     ROS_INFO("I heard: [%s]", msg->type.c_str());
     ++logical_clock;
+    last_timestamp = std::max(last_timestamp, msg->timestamp);
 
     if (msg->type == "Status") {
+        tracer.record(msg->Header, "knowledge");
+        if (!msg->Header.frame_id.empty()) last_trace = msg->Header.frame_id;
         arrived_status++;
         persistStatus(msg->timestamp, msg->source, msg->target, msg->content);
-        status[msg->source].push_back({nowInSeconds(), msg->content});
+        status[msg->source].push(nowInSeconds().toSec(), msg->content);
     } else if (msg->type == "EnergyStatus") {
         if(msg->source != "/engine") {
             std::string component_name = msg->source;
@@ -219,6 +299,7 @@ bool DataAccess::processQuery(archlib::DataAccessRequest::Request &req, archlib:
 
             if (query.size() > 1){
                 if (query[1] == "reliability") {
+                    res.trace = last_trace;
                     applyTimeWindow();
                     for (auto it : status) {
                         res.content += calculateComponentReliability(it.first);
@@ -248,10 +329,35 @@ bool DataAccess::processQuery(archlib::DataAccessRequest::Request &req, archlib:
                         }
                     }
                 } else if (query[1] == "cost") {
+                    res.trace = last_trace;
                     applyTimeWindow();
                     for (auto it : status) {
                         res.content += calculateComponentCost(it.first, req.name);
                     }
+                } else if (query[1] == "history" && query.size() == 5) {
+                    // wait smth like "/g3t1_3:history:reliability:3600:60" -> return the reliability of /g3t1_3 in each
+                    // minute of the last hour of logs, as "/g3t1_3:0.98,0.97,,0.99;", empty where it logged nothing
+                    flush();
+                    int64_t to = last_timestamp + 1;
+                    int64_t from = to - static_cast<int64_t>(std::stod(query[3]) * 1e9);
+                    int64_t bucket = static_cast<int64_t>(std::stod(query[4]) * 1e9);
+                    std::string component = query[0] == "all" ? "" : query[0];
+
+                    std::map<std::string, std::vector<double>> series;
+                    if (query[2] == "reliability") {
+                        series = history->reliability(component, from, to, bucket);
+                    } else if (query[2] == "cost") {
+                        series = history->cost(component, from, to, bucket);
+                    }
+
+                    for (const auto &it : series) {
+                        res.content += it.first + ":";
+                        for (size_t i = 0; i < it.second.size(); ++i) {
+                            if (i > 0) res.content += ",";
+                            if (!std::isnan(it.second[i])) res.content += std::to_string(it.second[i]);
+                        }
+                        res.content += ";";
+                    }
                 }
             }
             
@@ -297,65 +403,68 @@ void DataAccess::persistAdaptation(const int64_t &timestamp, const std::string &
     if(logical_clock % 30 == 0) flush();
 }
 
+void DataAccess::openLog(const std::string &filepath, const std::shared_ptr<bsn::storage::SegmentedLog> &segments) {
+    if (!segments) fp.open(filepath, std::fstream::in | std::fstream::out | std::fstream::app);
+}
+
+void DataAccess::writeLine(const std::shared_ptr<bsn::storage::SegmentedLog> &segments, const std::shared_ptr<bsn::storage::ColumnWriter> &columns,
+                           const std::string &name, const int64_t &logical_clock, const int64_t &timestamp,
+                           const std::string &source, const std::string &target, const std::string &content) {
+    if (segments) {
+        segments->append(name + "," + std::to_string(logical_clock) + "," + std::to_string(timestamp) + "," + source + "," + target + "," + content);
+    } else {
+        fp << name << ",";
+        fp << logical_clock << ",";
+        fp << timestamp << ",";
+        fp << source << ",";
+        fp << target << ",";
+        fp << content << "\n";
+    }
+    if (columns) columns->append(name, logical_clock, timestamp, source, target, content);
+}
+
+void DataAccess::closeLog(const std::shared_ptr<bsn::storage::SegmentedLog> &segments) {
+    if (segments) {
+        segments->flush();
+    } else {
+        fp.close();
+    }
+}
+
 void DataAccess::flush(){
-    fp.open(status_filepath, std::fstream::in | std::fstream::out | std::fstream::app);   
+    openLog(status_filepath, status_segments);
     for(std::vector<StatusMessage>::iterator it = statusVec.begin(); it != statusVec.end(); ++it) {
-        fp << (*it).getName() << ",";
-        fp << (*it).getLogicalClock() << ",";
-        fp << (*it).getTimestamp() << ",";
-        fp << (*it).getSource() << ",";
-        fp << (*it).getTarget() << ",";
-        fp << (*it).getState() << "\n";
+        writeLine(status_segments, status_columns, (*it).getName(), (*it).getLogicalClock(), (*it).getTimestamp(), (*it).getSource(), (*it).getTarget(), (*it).getState());
     }
-    fp.close();
+    closeLog(status_segments);
     statusVec.clear();
 
-    fp.open(energy_status_filepath, std::fstream::in | std::fstream::out | std::fstream::app);   
+    openLog(energy_status_filepath, energy_status_segments);
     for(std::vector<EnergyStatusMessage>::iterator it = energystatusVec.begin(); it != energystatusVec.end(); ++it) {
-        fp << (*it).getName() << ",";
-        fp << (*it).getLogicalClock() << ",";
-        fp << (*it).getTimestamp() << ",";
-        fp << (*it).getSource() << ",";
-        fp << (*it).getTarget() << ",";
-        fp << (*it).getCost() << "\n";
+        writeLine(energy_status_segments, energy_status_columns, (*it).getName(), (*it).getLogicalClock(), (*it).getTimestamp(), (*it).getSource(), (*it).getTarget(), (*it).getCost());
     }
-    fp.close();
+    closeLog(energy_status_segments);
     energystatusVec.clear();
 
-    fp.open(event_filepath, std::fstream::in | std::fstream::out | std::fstream::app);   
+    openLog(event_filepath, event_segments);
     for(std::vector<EventMessage>::iterator it = eventVec.begin(); it != eventVec.end(); ++it) {
-        fp << (*it).getName() << ",";
-        fp << (*it).getLogicalClock() << ",";
-        fp << (*it).getTimestamp() << ",";
-        fp << (*it).getSource() << ",";
-        fp << (*it).getTarget() << ",";
-        fp << (*it).getEvent() << "\n";
+        writeLine(event_segments, event_columns, (*it).getName(), (*it).getLogicalClock(), (*it).getTimestamp(), (*it).getSource(), (*it).getTarget(), (*it).getEvent());
     }
-    fp.close();
+    closeLog(event_segments);
     eventVec.clear();
 
-    fp.open(uncertainty_filepath, std::fstream::in | std::fstream::out | std::fstream::app);   
+    openLog(uncertainty_filepath, uncertainty_segments);
     for(std::vector<UncertaintyMessage>::iterator it = uncertainVec.begin(); it != uncertainVec.end(); ++it) {
-        fp << (*it).getName() << ",";
-        fp << (*it).getLogicalClock() << ",";
-        fp << (*it).getTimestamp() << ",";
-        fp << (*it).getSource() << ",";
-        fp << (*it).getTarget() << ",";
-        fp << (*it).getContent() << "\n";
+        writeLine(uncertainty_segments, uncertainty_columns, (*it).getName(), (*it).getLogicalClock(), (*it).getTimestamp(), (*it).getSource(), (*it).getTarget(), (*it).getContent());
     }
-    fp.close();
+    closeLog(uncertainty_segments);
     uncertainVec.clear();
 
-    fp.open(adaptation_filepath, std::fstream::in | std::fstream::out | std::fstream::app);   
+    openLog(adaptation_filepath, adaptation_segments);
     for(std::vector<AdaptationMessage>::iterator it = adaptVec.begin(); it != adaptVec.end(); ++it) {
-        fp << (*it).getName() << ",";
-        fp << (*it).getLogicalClock() << ",";
-        fp << (*it).getTimestamp() << ",";
-        fp << (*it).getSource() << ",";
-        fp << (*it).getTarget() << ",";
-        fp << (*it).getContent() << "\n";
+        writeLine(adaptation_segments, adaptation_columns, (*it).getName(), (*it).getLogicalClock(), (*it).getTimestamp(), (*it).getSource(), (*it).getTarget(), (*it).getContent());
     }
-    fp.close();
+    closeLog(adaptation_segments);
     adaptVec.clear();
 }
 
@@ -367,31 +476,24 @@ std::string DataAccess::calculateComponentReliability(const std::string& compone
     std::string aux = component, content = "";
     aux += ":";
     bool flag = false;
-    double sum = 0;
-    uint32_t len = 0;
-    for (auto value : status[component]) {
-        // reliability = success/(success + fails)
-        if (value.second == "success") { // calculate reliability
-            sum +=1;
-            len++;
-        } else if (value.second == "fail") {
-            len++;
-        }
-        else { // it can be other values
+    const bsn::control::StatusWindow &window = status[component];
+    for (auto value : window.getStatuses()) {
+        // reliability = success/(success + fails), it can be other values
+        if (value.second != "success" && value.second != "fail") {
             aux += value.second;
             aux += ",";
         }
         
         flag = true;
     }
-    aux += std::to_string((len > 0) ? sum / len : 0) + ';';
+    aux += std::to_string(window.reliability()) + ';';
 
     std::string key = component;
     key = key.substr(1, key.size());
 
     if(flag) content += aux;
 
-    components_reliabilities[key] = (len > 0) ? sum / len : 0;
+    components_reliabilities[key] = window.reliability();
 
     return content;
 }
@@ -419,19 +521,9 @@ std::string DataAccess::calculateComponentCost(const std::string& component, std
 }
 
 void DataAccess::applyTimeWindow() {
-    auto now = nowInSeconds();
+    double now = nowInSeconds().toSec();
 
     for (auto& component : status) {
-        auto& deq = component.second;
-        while (!deq.empty()) {
-            auto time_arrived = deq.front().first;
-            double time_span = std::chrono::duration_cast<std::chrono::duration<double>>(now - time_arrived).count();
-            if (time_span >= 10.1) {
-                deq.pop_front();
-            } else {
-                component.second = deq;
-                break;
-            }
-        }
+        component.second.slide(now);
     }
 }
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include "archlib/EnergyStatus.h"
 #include "archlib/Event.h"
 #include "archlib/AdaptationCommand.h"
+#include "archlib/AdaptationCommandSet.h"
+#include "archlib/AdaptationCommands.hpp"
 #include "archlib/Uncertainty.h"
 #include "archlib/Persist.h"
 
@@ -32,7 +34,7 @@ class Logger : public arch::ROSComponent {
 		virtual void tearDown();
 		virtual void body();
 
-	  	void receiveAdaptationCommand(const archlib::AdaptationCommand::ConstPtr& msg);
+	  	void receiveAdaptationCommands(const archlib::AdaptationCommandSet::ConstPtr& msg);
 	  	void receiveStatus(const archlib::Status::ConstPtr& msg);
 		void receiveEnergyStatus(const archlib::EnergyStatus::ConstPtr& msg);
 	  	void receiveEvent(const archlib::Event::ConstPtr& msg);
@@ -43,6 +45,8 @@ class Logger : public arch::ROSComponent {
 
 	private:
 		int64_t time_ref;
+		// republishes what it logs, unless the senders publish it directly (direct_control)
+		bool relay;
 		ros::Publisher adapt, status, event, persist;
 };
 
@@ -1,23 +1,30 @@
 #include "Logger.hpp"
 
 
-Logger::Logger(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), time_ref() {}
+Logger::Logger(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), time_ref(), relay(true) {}
 Logger::~Logger() {}
 
 int64_t Logger::now() const{
-    return std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    // ros time follows /clock when /use_sim_time is set
+    return ros::Time::now().toNSec();
 }
 
 void Logger::setUp() {
     time_ref = this->now();
 
-    adapt = handle.advertise<archlib::AdaptationCommand>("reconfigure", 1000);
+    bool direct_control = false;
+    handle.getParam("direct_control", direct_control);
+    relay = !direct_control;
+
     persist = handle.advertise<archlib::Persist>("persist", 1000);
-    status = handle.advertise<archlib::Status>("status", 1000);
-    event = handle.advertise<archlib::Event>("event", 1000);
+    if (relay) {
+        adapt = handle.advertise<archlib::AdaptationCommandSet>("reconfigure", 1000);
+        status = handle.advertise<archlib::Status>("status", 1000);
+        event = handle.advertise<archlib::Event>("event", 1000);
+    }
 
     double freq;
-	handle.getParam("frequency", freq);
+	getParam("frequency", freq);
 	rosComponentDescriptor.setFreq(freq);
 }
 
@@ -25,33 +32,44 @@ void Logger::tearDown() {}
 
 void Logger::body() {
     ros::NodeHandle n;
-    ros::Subscriber reconfig_sub = n.subscribe("log_adapt", 1000, &Logger::receiveAdaptationCommand, this);
-    ros::Subscriber status_sub = n.subscribe("log_status", 1000, &Logger::receiveStatus, this);
+    // when not relaying, it is a passive tap on the topics the others talk over
+    ros::Subscriber reconfig_sub = n.subscribe(relay ? "log_adapt" : "reconfigure", 1000, &Logger::receiveAdaptationCommands, this);
+    ros::Subscriber status_sub = n.subscribe(relay ? "log_status" : "status", 1000, &Logger::receiveStatus, this);
     ros::Subscriber energy_status_sub = n.subscribe("log_energy_status", 1000, &Logger::receiveEnergyStatus, this);
-    ros::Subscriber event_sub = n.subscribe("log_event", 1000, &Logger::receiveEvent, this);
+    ros::Subscriber event_sub = n.subscribe(relay ? "log_event" : "event", 1000, &Logger::receiveEvent, this);
     ros::Subscriber uncertainty_sub = n.subscribe("log_uncertainty", 1000, &Logger::receiveUncertainty, this);
     ros::spin();
 }
 
-void Logger::receiveAdaptationCommand(const archlib::AdaptationCommand::ConstPtr& msg) {
-    //ROS_INFO("I heard: [%s: %s]", msg->action.c_str(), msg->target.c_str());
+void Logger::receiveAdaptationCommands(const archlib::AdaptationCommandSet::ConstPtr& msg) {
+    int64_t timestamp = this->now()-time_ref;
+    tracer.record(msg->Header, "log_command");
 
-    archlib::Persist persistMsg;
-    persistMsg.source = msg->source;
-    persistMsg.target = msg->target;
-    persistMsg.type = "AdaptationCommand";
-    persistMsg.timestamp = this->now()-time_ref;
-    persistMsg.content = msg->action;
+    // one record per command, as they were logged when sent one by one
+    for (const archlib::AdaptationCommand &command : msg->commands) {
+        //ROS_INFO("I heard: [%s: %s]", arch::toString(command).c_str(), command.target.c_str());
 
-    persist.publish(persistMsg);
-    adapt.publish(msg);
+        archlib::Persist persistMsg;
+        persistMsg.Header = command.Header;
+        persistMsg.source = command.source;
+        persistMsg.target = command.target;
+        persistMsg.type = "AdaptationCommand";
+        persistMsg.timestamp = timestamp;
+        persistMsg.content = arch::toString(command);
+
+        persist.publish(persistMsg);
+    }
+
+    if (relay) adapt.publish(msg);
 }
 
 
 void Logger::receiveStatus(const archlib::Status::ConstPtr& msg) {
     //ROS_INFO("I heard: [%s: %s]", msg->source.c_str(), msg->content.c_str());
+    tracer.record(msg->Header, "log_status");
 
     archlib::Persist persistMsg;
+    persistMsg.Header = msg->Header;
     persistMsg.source = msg->source;
     persistMsg.target = msg->target;
     persistMsg.type = "Status";
@@ -59,7 +77,7 @@ void Logger::receiveStatus(const archlib::Status::ConstPtr& msg) {
     persistMsg.content = msg->content;
 
     persist.publish(persistMsg);
-    status.publish(msg);
+    if (relay) status.publish(msg);
 }
 
 void Logger::receiveEnergyStatus(const archlib::EnergyStatus::ConstPtr& msg) {
@@ -86,7 +104,7 @@ void Logger::receiveEvent(const archlib::Event::ConstPtr& msg) {
     persistMsg.content = msg->content;
 
     persist.publish(persistMsg);
-    event.publish(msg);
+    if (relay) event.publish(msg);
 }
 
 void Logger::receiveUncertainty(const archlib::Uncertainty::ConstPtr& msg) {
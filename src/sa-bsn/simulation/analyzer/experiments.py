@@ -0,0 +1,9 @@
+from src import Experiments as exp
+import sys
+
+def main():
+    experiments = exp.Experiments(len(sys.argv), sys.argv)
+    experiments.run()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,9 @@
+from src import Latency as lat
+import sys
+
+def main():
+    latency = lat.Latency(len(sys.argv), sys.argv)
+    latency.run()
+
+if __name__ == "__main__":
+    main()
@@ -20,7 +20,9 @@ from collections import OrderedDict
 
 class Analyzer:
 
-    def __init__(self, argc, argv):
+    # log_dir and models_dir default to the knowledge repository, as seen from this
+    # directory; with a figure path, the plot is saved there instead of shown
+    def __init__(self, argc, argv, log_dir="../../knowledge_repository/resource/logs", models_dir="../../knowledge_repository/resource/models", figure=None):
         if len(argv) != 5:
             print("---------------------------------------------")
             print("Too few arguments were provided!")
@@ -54,6 +56,10 @@ class Analyzer:
         self.sse = 0
         self.robustness = 0
         self.mean = 0
+
+        self.log_dir = log_dir
+        self.models_dir = models_dir
+        self.figure = figure
         
     # computes the average for evey truncated (which dependes on the resolution) x value 
     # [38.1, 38.5, 38.7]:[5, 10, 15] returns [38,15]
@@ -129,7 +135,7 @@ class Analyzer:
 
     def run(self): 
         # load formula
-        #formula = Formula("../../knowledge_repository/resource/models/"+self.formula_id+".formula", "float")
+        #formula = Formula(self.models_dir + "/"+self.formula_id+".formula", "float")
         #b_formula = Formula("../../knowledge_repository/resource/models/b_"+self.formula_id+".formula", "bool")
 
         # build list of participating tasks
@@ -152,31 +158,31 @@ class Analyzer:
         ################################################################## 
 
         ################ load adaptation log ################
-        with open("../../knowledge_repository/resource/logs/adaptation_" + self.file_id + ".log", newline='') as log_file:
+        with open(self.log_dir + "/adaptation_" + self.file_id + ".log", newline='') as log_file:
             log_csv = csv.reader(log_file, delimiter=',')
             log_adaptation = list(log_csv)
             del log_adaptation[0] # delete first line
 
         ################ load status log ################
-        with open("../../knowledge_repository/resource/logs/status_" + self.file_id + ".log", newline='') as log_file:
+        with open(self.log_dir + "/status_" + self.file_id + ".log", newline='') as log_file:
             log_csv = csv.reader(log_file, delimiter=',')
             log_status = list(log_csv)
             del log_status[0] # delete first line
         
         ################ load energy status log ################
-        with open("../../knowledge_repository/resource/logs/energystatus_" + self.file_id + ".log", newline='') as log_file:
+        with open(self.log_dir + "/energystatus_" + self.file_id + ".log", newline='') as log_file:
             log_csv = csv.reader(log_file, delimiter=',')
             log_energy_status = list(log_csv)
             del log_energy_status[0] # delete first line
 
         ################ load event log ################
-        with open("../../knowledge_repository/resource/logs/event_" + self.file_id + ".log", newline='') as log_file:
+        with open(self.log_dir + "/event_" + self.file_id + ".log", newline='') as log_file:
             log_csv = csv.reader(log_file, delimiter=',')
             log_event = list(log_csv)
             del log_event[0] # delete first line
 
         ################ load uncertainty log ################
-        with open("../../knowledge_repository/resource/logs/uncertainty_" + self.file_id + ".log", newline='') as log_file:
+        with open(self.log_dir + "/uncertainty_" + self.file_id + ".log", newline='') as log_file:
             log_csv = csv.reader(log_file, delimiter=',')
             log_uncert = list(log_csv)
             del log_uncert[0] # delete first line
@@ -206,7 +212,7 @@ class Analyzer:
             term = "CTX_" + component
             terms_to_remove.append(term)
 
-        formula = Formula("../../knowledge_repository/resource/models/"+self.formula_id+".formula", "float", terms_to_remove)
+        formula = Formula(self.models_dir + "/"+self.formula_id+".formula", "float", terms_to_remove)
         #concatenate lists into one log list
         log = list()
         if self.formula_id == "reliability":
@@ -570,7 +576,14 @@ class Analyzer:
         #    )
         #plt.grid()
 
-        plt.show()
+        if self.figure is None:
+            plt.show()
+        else:
+            plt.savefig(self.figure)
+            plt.close('all')
+
+        return {"mean": self.mean, "stability": self.stability, "settling_time": self.settling_time,
+                "overshoot": self.overshoot, "sse": self.sse, "robustness": self.robustness}
 
 class Formula:
 
@@ -0,0 +1,160 @@
+#for reading the matrix and writing the results
+import csv
+import json
+
+#for running the experiments
+import itertools
+import os
+import signal
+import subprocess
+import sys
+import time
+from concurrent.futures import ProcessPoolExecutor, ThreadPoolExecutor
+
+#for plotting without a display
+import matplotlib
+matplotlib.use("Agg")
+
+from src import Analyzer as stat
+
+BSN = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", ".."))
+
+METRICS = ["mean", "stability", "settling_time", "overshoot", "sse", "robustness"]
+
+# each experiment is the whole system launched on a ros master of its own, logging
+# to its own directory; with sim_time it runs on the simulated clock and ends by itself
+LAUNCH = """<launch>
+    <include file="{bsn}/configurations/bsn.launch" />
+{sim_clock}
+    <param name="/data_access/log_dir" value="{log_dir}" />
+{params}
+</launch>
+"""
+
+SIM_CLOCK = """    <include file="{bsn}/configurations/simulation/sim_clock.launch" />
+    <param name="/sim_clock/duration" value="{duration}" />
+"""
+
+def analyze(log_dir, metric, setpoint):
+    logs = [f for f in os.listdir(log_dir) if f.startswith("status_") and f.endswith(".log")]
+    if not logs:
+        raise RuntimeError("no logs in " + log_dir)
+    log_id = logs[0][len("status_"):-len(".log")]
+
+    # the analyzer prints every register, keep that out of the way
+    with open(os.path.join(log_dir, "analyzer.out"), "w") as out:
+        stdout, sys.stdout = sys.stdout, out
+        try:
+            analyzer = stat.Analyzer(5, ["analyzer.py", log_id, metric, "False", str(setpoint)],
+                log_dir=log_dir, models_dir=os.path.join(BSN, "knowledge_repository", "resource", "models"),
+                figure=os.path.join(log_dir, metric + ".png"))
+            return analyzer.run()
+        finally:
+            sys.stdout = stdout
+
+class Experiments:
+
+    def __init__(self, argc, argv):
+        if argc < 2:
+            print("---------------------------------------------")
+            print("Usage: experiments.py [matrix.json] [jobs] [results_dir]")
+            print("---------------------------------------------")
+            exit()
+        with open(argv[1]) as f:
+            self.matrix = json.load(f)
+        self.jobs = int(argv[2]) if argc > 2 else os.cpu_count()
+        self.results_dir = os.path.abspath(argv[3] if argc > 3 else "results")
+
+        self.duration = self.matrix.get("duration", 300)
+        self.sim_time = self.matrix.get("sim_time", False)
+        self.metric = self.matrix.get("metric", "reliability")
+        self.repetitions = self.matrix.get("repetitions", 1)
+        self.base_port = self.matrix.get("base_port", 11411)
+
+    # every combination of the swept values; a list sweeps one parameter, an object
+    # sweeps named profiles, each setting several parameters (e.g. the injector's)
+    def points(self):
+        axes = []
+        for name, values in self.matrix.get("sweep", {}).items():
+            if isinstance(values, dict):
+                axes.append([(name, profile, params) for profile, params in values.items()])
+            else:
+                axes.append([(name, value, {name: value}) for value in values])
+
+        points = []
+        for combination in itertools.product(*axes):
+            labels = {name: label for name, label, _ in combination}
+            params = dict(self.matrix.get("fixed", {}))
+            for _, _, p in combination:
+                params.update(p)
+            for repetition in range(self.repetitions):
+                points.append((labels, params, repetition))
+        return points
+
+    def launch_file(self, directory, params):
+        sim_clock = SIM_CLOCK.format(bsn=BSN, duration=self.duration) if self.sim_time else ""
+        lines = ['    <param name="{}" value="{}" />'.format(name, str(value).lower() if isinstance(value, bool) else value)
+                 for name, value in sorted(params.items())]
+
+        path = os.path.join(directory, "experiment.launch")
+        with open(path, "w") as f:
+            f.write(LAUNCH.format(bsn=BSN, sim_clock=sim_clock, log_dir=directory, params="\n".join(lines)))
+        return path
+
+    def execute(self, index, params):
+        directory = os.path.join(self.results_dir, str(index))
+        os.makedirs(directory, exist_ok=True)
+        launch = self.launch_file(directory, params)
+
+        port = self.base_port + index
+        env = dict(os.environ, ROS_MASTER_URI="http://localhost:" + str(port), ROS_HOME=os.path.join(directory, "ros"))
+
+        begin = time.time()
+        with open(os.path.join(directory, "roslaunch.out"), "w") as out:
+            # its own process group, so that stopping it stops every node
+            process = subprocess.Popen(["roslaunch", "-p", str(port), launch], stdout=out, stderr=subprocess.STDOUT,
+                                       env=env, start_new_session=True)
+            try:
+                # under simulated time sim_clock ends the launch, the timeout is a safety net
+                process.wait(timeout=self.duration * (10 if self.sim_time else 1))
+            except subprocess.TimeoutExpired:
+                os.killpg(process.pid, signal.SIGINT)
+                try:
+                    process.wait(timeout=30)
+                except subprocess.TimeoutExpired:
+                    os.killpg(process.pid, signal.SIGKILL)
+                    process.wait()
+
+        return directory, time.time() - begin
+
+    def run(self):
+        points = self.points()
+        os.makedirs(self.results_dir, exist_ok=True)
+        print("Running " + str(len(points)) + " experiments, " + str(self.jobs) + " at a time")
+
+        # launches only wait on their nodes, the analyses are what take cpu in here
+        with ThreadPoolExecutor(self.jobs) as launches, ProcessPoolExecutor(self.jobs) as analyses:
+            runs = [launches.submit(self.execute, index, params) for index, (_, params, _) in enumerate(points)]
+
+            results = []
+            for index, ((labels, params, repetition), run) in enumerate(zip(points, runs)):
+                directory, wall = run.result()
+                setpoint = params.get("/setpoint", self.matrix.get("setpoint", 0.9))
+                results.append((index, labels, repetition, wall, analyses.submit(analyze, directory, self.metric, setpoint)))
+
+            columns = list(self.matrix.get("sweep", {}).keys())
+            path = os.path.join(self.results_dir, "results.csv")
+            with open(path, "w", newline="") as f:
+                writer = csv.writer(f)
+                writer.writerow(["experiment"] + columns + ["repetition", "wall_time"] + METRICS + ["error"])
+                for index, labels, repetition, wall, analysis in results:
+                    row = [index] + [labels[c] for c in columns] + [repetition, "%.1f" % wall]
+                    try:
+                        metrics = analysis.result()
+                        row += [metrics[m] for m in METRICS] + [""]
+                    except Exception as e:
+                        row += [""] * len(METRICS) + [str(e)]
+                    writer.writerow(row)
+                    print("experiment " + str(index) + ": " + ", ".join(str(v) for v in row[1:]))
+
+        print("Results in " + path)
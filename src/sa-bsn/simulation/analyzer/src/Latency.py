@@ -0,0 +1,88 @@
+#for reading traces
+import csv
+import glob
+import os
+
+#for summaries
+from statistics import mean, median
+
+#for ordered dict
+from collections import OrderedDict
+
+# every stage of the loop goes from the first hop to the second one
+STAGES = OrderedDict([
+    ("monitor", ("status", "knowledge")),
+    ("analyze", ("knowledge", "analyze")),
+    ("plan", ("analyze", "plan")),
+    ("execute", ("plan", "reconfigure")),
+])
+
+class Latency:
+
+    def __init__(self, argc, argv):
+        if argc != 2:
+            print("---------------------------------------------")
+            print("Usage: latency.py [trace_dir]")
+            print("---------------------------------------------")
+            exit()
+        self.trace_dir = argv[1]
+        # trace -> hop -> times (s) it passed through the hop
+        self.traces = {}
+
+    # reads every <node>.trace file, lines are trace,hop,node,time (ns)
+    def read(self):
+        files = glob.glob(os.path.join(self.trace_dir, "*.trace"))
+        if not files:
+            print("No trace files found in " + self.trace_dir)
+            exit()
+
+        for path in files:
+            with open(path, newline='') as f:
+                for row in csv.reader(f):
+                    if len(row) != 4: continue
+                    hops = self.traces.setdefault(row[0], {})
+                    hops.setdefault(row[1], []).append(int(row[3]) / 1e9)
+
+    # the first time a trace passed through every hop, but the last reconfiguration,
+    # since the adaptation is only over when every command has been applied
+    def breakdown(self, hops):
+        if "plan" not in hops or "reconfigure" not in hops:
+            return None
+
+        first = {hop: min(times) for hop, times in hops.items()}
+        first["reconfigure"] = max(hops["reconfigure"])
+
+        stages = OrderedDict()
+        for stage, (begin, end) in STAGES.items():
+            if begin not in first or end not in first:
+                return None
+            stages[stage] = first[end] - first[begin]
+        return stages
+
+    def run(self):
+        self.read()
+
+        adaptations = []
+        for trace in sorted(self.traces):
+            stages = self.breakdown(self.traces[trace])
+            if stages is not None:
+                adaptations.append((trace, stages))
+
+        if not adaptations:
+            print("No trace went all the way around the loop.")
+            return
+
+        header = "{:<20}".format("trace") + "".join("{:>12}".format(s) for s in STAGES) + "{:>12}".format("total")
+        print(header)
+        for trace, stages in adaptations:
+            total = sum(stages.values())
+            print("{:<20}".format(trace) + "".join("{:>12.3f}".format(1000 * v) for v in stages.values()) + "{:>12.3f}".format(1000 * total))
+
+        print("-" * len(header))
+        for name, summary in (("mean", mean), ("median", median), ("max", max)):
+            values = [summary([stages[s] for _, stages in adaptations]) for s in STAGES]
+            total = summary([sum(stages.values()) for _, stages in adaptations])
+            print("{:<20}".format(name) + "".join("{:>12.3f}".format(1000 * v) for v in values) + "{:>12.3f}".format(1000 * total))
+
+        print("")
+        print(str(len(adaptations)) + " adaptations, latencies in ms")
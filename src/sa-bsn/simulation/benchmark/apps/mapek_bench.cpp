@@ -0,0 +1,57 @@
+#include "Harness.hpp"
+
+#include <fstream>
+#include <iostream>
+
+/*
+ * mapek_bench <configurations dir> <reliability formula> [name:=value ...]
+ *
+ * where name is one of ticks, sensor_freq, hub_freq, noise_factor, seed or adaptation_parameter
+ */
+int32_t main(int argc, char **argv) {
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <configurations dir> <reliability formula> [ticks|sensor_freq|hub_freq|noise_factor|seed|adaptation_parameter:=value ...]" << std::endl;
+        return 1;
+    }
+
+    std::string configurations = argv[1];
+    LaunchParams params;
+    std::string formula;
+    Harness::Options options;
+
+    try {
+        params.load(configurations + "/environment/patient.launch");
+        params.load(configurations + "/target_system/sensors.launch");
+        params.load(configurations + "/system_manager/strategy_manager.launch");
+        params.load(configurations + "/system_manager/strategy_enactor.launch");
+
+        std::ifstream file(argv[2]);
+        if (!std::getline(file, formula)) throw std::invalid_argument(std::string("could not read formula ") + argv[2]);
+
+        for (int i = 3; i < argc; ++i) {
+            std::string arg = argv[i];
+            size_t sep = arg.find(":=");
+            if (sep == std::string::npos) throw std::invalid_argument("expected name:=value, got " + arg);
+
+            std::string name = arg.substr(0, sep);
+            std::string value = arg.substr(sep + 2);
+
+            if (name == "ticks") options.ticks = std::stoull(value);
+            else if (name == "sensor_freq") options.sensor_freq = std::stod(value);
+            else if (name == "hub_freq") options.hub_freq = std::stod(value);
+            else if (name == "noise_factor") options.noise_factor = std::stod(value);
+            else if (name == "seed") options.seed = std::stoull(value);
+            else if (name == "adaptation_parameter") options.adaptation_parameter = value;
+            else throw std::invalid_argument("unknown option " + name);
+        }
+
+        Harness harness(params, formula, options);
+        harness.run();
+        harness.report(std::cout);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
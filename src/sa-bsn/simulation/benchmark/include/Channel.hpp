@@ -0,0 +1,88 @@
+#ifndef CHANNEL_HPP
+#define CHANNEL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/*
+ * Bounded blocking queue connecting two stages of the harness, stands
+ * for a ROS topic. Each item is stamped when pushed, so that consumers
+ * can tell how long it waited in the queue.
+ *
+ * The channel is closed once every one of its producers called close(),
+ * pop() then drains what is left and returns false.
+ */
+template <typename T>
+class Channel {
+
+	public:
+		typedef std::chrono::steady_clock Clock;
+
+		Channel(const size_t &capacity = 1024, const int &producers = 1) : capacity(capacity), producers(producers), items(), mutex(), not_empty(), not_full() {}
+		~Channel() {}
+
+	private:
+		Channel(const Channel &);
+		Channel &operator=(const Channel &);
+
+	public:
+		void push(const T &item) {
+			std::unique_lock<std::mutex> lock(mutex);
+			not_full.wait(lock, [this]{ return items.size() < capacity; });
+			items.push_back(std::make_pair(item, Clock::now()));
+			not_empty.notify_one();
+		}
+
+		// drops the item instead of blocking when the queue is full, as a ROS topic would
+		bool tryPush(const T &item) {
+			std::unique_lock<std::mutex> lock(mutex);
+			if (items.size() >= capacity) return false;
+
+			items.push_back(std::make_pair(item, Clock::now()));
+			not_empty.notify_one();
+			return true;
+		}
+
+		// blocks until an item arrives, waited is set to the time it spent queued (in seconds)
+		bool pop(T &item, double &waited) {
+			std::unique_lock<std::mutex> lock(mutex);
+			not_empty.wait(lock, [this]{ return !items.empty() || producers <= 0; });
+			if (items.empty()) return false;
+
+			item = items.front().first;
+			waited = std::chrono::duration<double>(Clock::now() - items.front().second).count();
+			items.pop_front();
+			not_full.notify_one();
+			return true;
+		}
+
+		// never blocks, for side channels polled by a stage between items
+		bool tryPop(T &item) {
+			std::unique_lock<std::mutex> lock(mutex);
+			if (items.empty()) return false;
+
+			item = items.front().first;
+			items.pop_front();
+			not_full.notify_one();
+			return true;
+		}
+
+		void close() {
+			std::unique_lock<std::mutex> lock(mutex);
+			--producers;
+			not_empty.notify_all();
+		}
+
+	private:
+		size_t capacity;
+		int producers;
+		std::deque<std::pair<T, Clock::time_point>> items;
+		std::mutex mutex;
+		std::condition_variable not_empty;
+		std::condition_variable not_full;
+};
+
+#endif
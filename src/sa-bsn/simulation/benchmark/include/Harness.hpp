@@ -0,0 +1,139 @@
+#ifndef HARNESS_HPP
+#define HARNESS_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "libbsn/configuration/SensorConfiguration.hpp"
+#include "libbsn/control/ProportionalController.hpp"
+#include "libbsn/filters/MovingAverage.hpp"
+#include "libbsn/generator/DataGenerator.hpp"
+#include "libbsn/generator/NoiseGenerator.hpp"
+#include "libbsn/model/Formula.hpp"
+
+#include "Channel.hpp"
+#include "LaunchParams.hpp"
+#include "StageStats.hpp"
+
+/*
+ * Runs the whole MAPE-K loop of the BSN in a single process, without a
+ * ROS master, to measure how fast each stage can go:
+ *
+ *   patient -> g3t1_* -> g4t1 -> knowledge -> engine -> enactor
+ *                 ^                                        |
+ *                 +------------ adaptation commands -------+
+ *
+ * Every stage is a thread and every topic an in-process Channel. Stages
+ * run the libbsn code of the corresponding nodes: data generators, sensor
+ * configurations, filters and data fusion, and the status window of
+ * DataAccess, the planner of ReliabilityEngine and the proportional
+ * control of Controller (bsn::control). Time is simulated: the patient emits one sample of every
+ * vital sign per tick, and all the periodic behaviour is driven by the
+ * timestamps of the samples, so stages run as fast as they can.
+ */
+class Harness {
+
+	public:
+		typedef std::chrono::steady_clock Clock;
+
+		struct Options {
+			Options() : ticks(100000), sensor_freq(10), hub_freq(6), noise_factor(0), seed(1), adaptation_parameter("reliability") {}
+
+			uint64_t ticks;		// patient samples to generate
+			double sensor_freq;	// initial frequency of the sensors (Hz)
+			double hub_freq;	// frequency of the data fusion (Hz)
+			double noise_factor;	// noise injected into every sensor, as Sensor::apply_noise
+			uint64_t seed;		// seed of the run, as the seed parameter of the nodes
+			std::string adaptation_parameter;	// replicate_collect to adapt how many replicas sensors collect instead of their frequency, as the enactor
+		};
+
+		Harness(const LaunchParams &params, const std::string &formula, const Options &options);
+		~Harness();
+
+	private:
+		Harness(const Harness &);
+		Harness &operator=(const Harness &);
+
+		struct VitalSample {
+			double time;
+			std::vector<double> values;
+			Clock::time_point created;
+		};
+
+		struct Reading {
+			int32_t id;
+			double risk;
+			double time;
+			Clock::time_point created;
+		};
+
+		struct Status {
+			std::string component;
+			double time;
+			bool success;
+		};
+
+		struct Control {
+			bool strategy;	// reference values from the engine, otherwise current reliabilities
+			std::map<std::string, double> values;
+		};
+
+		struct SensorStage {
+			SensorStage() : name(), vital_sign(), id(-1), channel(0), config(), filter(1), noise() {}
+
+			std::string name;
+			std::string vital_sign;
+			int32_t id;
+			size_t channel;
+			bsn::configuration::SensorConfiguration config;
+			bsn::filters::MovingAverage filter;
+			bsn::generator::NoiseGenerator noise;
+		};
+
+		void configure();
+		bsn::generator::DataGenerator configureDataGenerator(const std::string &vital_sign);
+		bsn::configuration::SensorConfiguration configureSensor(const std::string &vital_sign);
+
+		void patient();
+		void sensor(const size_t &index);
+		void hub();
+		void knowledge();
+		void engine();
+		void enactor();
+
+	public:
+		void run();
+		void report(std::ostream &os) const;
+
+	private:
+		LaunchParams params;
+		Options options;
+		bsn::model::Formula model;
+
+		std::vector<std::string> vital_signs;
+		std::vector<bsn::generator::DataGenerator> generators;
+		std::vector<double> changes;
+		std::vector<double> offsets;
+		std::vector<SensorStage> sensors;
+		std::map<std::string, size_t> components;
+		double tick_period;
+
+		std::vector<std::unique_ptr<Channel<VitalSample>>> samples;
+		std::vector<std::unique_ptr<Channel<bsn::control::ControlAction>>> commands;
+		std::unique_ptr<Channel<Reading>> readings;
+		std::unique_ptr<Channel<Status>> statuses;
+		Channel<std::map<std::string, double>> reliabilities;
+		Channel<Control> controls;
+		Channel<std::string> exceptions;
+
+		std::vector<StageStats> stats;
+		StageStats end_to_end;
+		uint64_t adaptations;
+		double wall_time;
+};
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef LAUNCHPARAMS_HPP
+#define LAUNCHPARAMS_HPP
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+/*
+ * Reads the <param name="..." value="..."/> entries of roslaunch files,
+ * so that the harness runs with the very same configuration as the
+ * deployed nodes without a parameter server. Parameters nested in a
+ * <node> are kept under "<node>/<name>", as the node's private ones.
+ */
+class LaunchParams {
+
+	public:
+		LaunchParams();
+		~LaunchParams();
+
+		LaunchParams(const LaunchParams &);
+		LaunchParams &operator=(const LaunchParams &);
+
+		// throws std::invalid_argument if the file cannot be read
+		void load(const std::string &path);
+
+		bool has(const std::string &key) const;
+		// throws std::out_of_range if the parameter was not loaded
+		std::string get(const std::string &key) const;
+		double getDouble(const std::string &key, const double &fallback) const;
+
+	private:
+		std::map<std::string, std::string> params;
+};
+
+#endif
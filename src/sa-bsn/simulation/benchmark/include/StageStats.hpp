@@ -0,0 +1,52 @@
+#ifndef STAGESTATS_HPP
+#define STAGESTATS_HPP
+
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*
+ * Per-stage measurements of the harness: how many items a stage handled,
+ * how long each one took to process (service time) and how long it sat
+ * in the stage's input queue before that (wait time). All times in seconds.
+ */
+class StageStats {
+
+	public:
+		typedef std::chrono::steady_clock Clock;
+
+		StageStats(const std::string &name);
+		~StageStats();
+
+		StageStats(const StageStats &);
+		StageStats &operator=(const StageStats &);
+
+		void start();
+		void stop();
+
+		void record(const double &service, const double &wait);
+
+		uint64_t getItems() const;
+		double getElapsed() const;
+		double getThroughput() const;
+
+		double meanService() const;
+		double meanWait() const;
+		// q in [0,1], e.g. 0.99 for the 99th percentile of the service time
+		double percentile(const double &q) const;
+
+		static void printHeader(std::ostream &os);
+		void print(std::ostream &os) const;
+
+	private:
+		std::string name;
+		std::vector<double> service;
+		double total_service;
+		double total_wait;
+		Clock::time_point begin;
+		Clock::time_point end;
+};
+
+#endif
@@ -0,0 +1,506 @@
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+#include "libbsn/control/ReliabilityPlanner.hpp"
+#include "libbsn/control/StatusWindow.hpp"
+#include "libbsn/processor/Processor.hpp"
+#include "libbsn/random/Seed.hpp"
+#include "libbsn/range/Range.hpp"
+#include "libbsn/utils/utils.hpp"
+
+using namespace bsn::range;
+using namespace bsn::configuration;
+using namespace bsn::control;
+
+namespace {
+    double seconds(const Harness::Clock::duration &d) {
+        return std::chrono::duration<double>(d).count();
+    }
+
+    Range range(const LaunchParams &params, const std::string &key) {
+        std::vector<std::string> bounds = bsn::utils::split(params.get(key), ',');
+        return Range(std::stod(bounds[0]), std::stod(bounds[1]));
+    }
+
+    // "/g3t1_1" -> "G3_T1_1", as the engines name the terms of the formula
+    std::string term(std::string component) {
+        std::transform(component.begin(), component.end(), component.begin(), ::toupper);
+        component.erase(0, 1);
+        component.insert(int(component.find('T')), "_");
+        return component;
+    }
+
+    // "R_G3_T1_1" -> "/g3t1_1", as ReliabilityEngine::execute
+    std::string component(std::string term) {
+        std::transform(term.begin(), term.end(), term.begin(), ::tolower);
+        std::vector<std::string> str = bsn::utils::split(term, '_');
+        std::string name = "/" + str[1] + str[2];
+        if (str.size() > 3) name += "_" + str[3];
+        return name;
+    }
+}
+
+Harness::Harness(const LaunchParams &params, const std::string &formula, const Options &options) :
+    params(params),
+    options(options),
+    model(formula),
+    vital_signs(),
+    generators(),
+    changes(),
+    offsets(),
+    sensors(),
+    components(),
+    tick_period(0),
+    samples(),
+    commands(),
+    readings(),
+    statuses(),
+    reliabilities(16),
+    controls(16, 2),
+    exceptions(16),
+    stats(),
+    end_to_end("end-to-end"),
+    adaptations(0),
+    wall_time(0) {
+        configure();
+    }
+
+Harness::~Harness() {}
+
+void Harness::configure() {
+    std::string s = params.get("vitalSigns");
+    s.erase(std::remove(s.begin(), s.end(), ' '), s.end());
+    vital_signs = bsn::utils::split(s, ',');
+
+    for (const std::string &vital_sign : vital_signs) {
+        generators.push_back(configureDataGenerator(vital_sign));
+        changes.push_back(1/params.getDouble(vital_sign + "_Change", 1));
+        offsets.push_back(params.getDouble(vital_sign + "_Offset", 0));
+    }
+
+    // one tick per vital_signs message, or per PatientModule cycle when streaming is off
+    double stream_freq = params.getDouble("streamFrequency", 0);
+    tick_period = (stream_freq > 0) ? 1/stream_freq : 0.001;
+
+    stats.push_back(StageStats("patient"));
+
+    for (const std::string &name : bsn::utils::split(params.get("sensors/sensors"), ',')) {
+        if (params.has("sensors/" + name + "/start") && params.get("sensors/" + name + "/start") == "false") continue;
+
+        SensorStage sensor;
+        sensor.name = name;
+        sensor.vital_sign = params.get("sensors/" + name + "/vital_sign");
+        sensor.id = bsn::processor::get_sensor_id(params.get("sensors/" + name + "/type"));
+
+        std::vector<std::string>::const_iterator it = std::find(vital_signs.begin(), vital_signs.end(), sensor.vital_sign);
+        if (it == vital_signs.end()) throw std::invalid_argument("patient does not simulate " + sensor.vital_sign);
+        sensor.channel = it - vital_signs.begin();
+
+        sensor.config = configureSensor(sensor.vital_sign);
+        sensor.noise = bsn::generator::NoiseGenerator(bsn::random::seed_for(options.seed, "/" + name));
+
+        components["/" + name] = sensors.size();
+        sensors.push_back(sensor);
+        stats.push_back(StageStats(name));
+    }
+
+    // the central hub listens for commands right after the sensors
+    components["/g4t1"] = sensors.size();
+
+    for (size_t i = 0; i < sensors.size(); ++i) {
+        samples.push_back(std::unique_ptr<Channel<VitalSample>>(new Channel<VitalSample>()));
+    }
+    for (size_t i = 0; i <= sensors.size(); ++i) {
+        commands.push_back(std::unique_ptr<Channel<ControlAction>>(new Channel<ControlAction>(16)));
+    }
+    readings.reset(new Channel<Reading>(1024, sensors.size()));
+    statuses.reset(new Channel<Status>(1024, sensors.size() + 1));
+
+    stats.push_back(StageStats("g4t1"));
+    stats.push_back(StageStats("knowledge"));
+    stats.push_back(StageStats("engine"));
+    stats.push_back(StageStats("enactor"));
+}
+
+/*
+ * Same markov chain and ranges as PatientModule::configureDataGenerator
+ */
+bsn::generator::DataGenerator Harness::configureDataGenerator(const std::string &vital_sign) {
+    std::vector<double> transitions;
+    std::vector<Range> ranges(5);
+
+    for (uint32_t j = 0; j < ranges.size(); j++) {
+        std::vector<std::string> t_probs = bsn::utils::split(params.get(vital_sign + "_State" + std::to_string(j)), ',');
+        for (uint32_t k = 0; k < ranges.size(); k++) {
+            transitions.push_back(std::stod(t_probs[k]));
+        }
+    }
+
+    ranges[0] = range(params, vital_sign + "_HighRisk0");
+    ranges[1] = range(params, vital_sign + "_MidRisk0");
+    ranges[2] = range(params, vital_sign + "_LowRisk");
+    ranges[3] = range(params, vital_sign + "_MidRisk1");
+    ranges[4] = range(params, vital_sign + "_HighRisk1");
+
+    bsn::generator::Markov markov(transitions, ranges, 2);
+    bsn::generator::DataGenerator dataGenerator(markov);
+    dataGenerator.setSeed(bsn::random::seed_for(options.seed, vital_sign));
+
+    return dataGenerator;
+}
+
+/*
+ * Same risk ranges and percentages as G3T1::setUp
+ */
+SensorConfiguration Harness::configureSensor(const std::string &vital_sign) {
+    std::array<Range, 2> midRanges = {{range(params, vital_sign + "_MidRisk0"), range(params, vital_sign + "_MidRisk1")}};
+    std::array<Range, 2> highRanges = {{range(params, vital_sign + "_HighRisk0"), range(params, vital_sign + "_HighRisk1")}};
+    std::array<Range, 3> percentages = {{range(params, "lowrisk"), range(params, "midrisk"), range(params, "highrisk")}};
+
+    return SensorConfiguration(0, range(params, vital_sign + "_LowRisk"), midRanges, highRanges, percentages);
+}
+
+void Harness::patient() {
+    StageStats &st = stats[0];
+    std::vector<double> since_change(vital_signs.size(), 0);
+
+    st.start();
+    for (uint64_t tick = 0; tick < options.ticks; ++tick) {
+        Clock::time_point begin = Clock::now();
+
+        VitalSample sample;
+        sample.time = tick * tick_period;
+        sample.values.reserve(vital_signs.size());
+
+        // PatientModule::advanceStates
+        for (size_t i = 0; i < vital_signs.size(); ++i) {
+            if (since_change[i] >= changes[i] + offsets[i]) {
+                generators[i].nextState();
+                since_change[i] = offsets[i];
+            } else {
+                since_change[i] += tick_period;
+            }
+            sample.values.push_back(generators[i].getValue());
+        }
+
+        sample.created = Clock::now();
+        st.record(seconds(sample.created - begin), 0);
+
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i]->push(sample);
+        }
+    }
+
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i]->close();
+    }
+    st.stop();
+}
+
+void Harness::sensor(const size_t &index) {
+    SensorStage &sensor = sensors[index];
+    StageStats &st = stats[index + 1];
+
+    double freq = options.sensor_freq;
+    uint32_t replicate_collect = 1;
+    double next = 0;
+    double waited;
+    VitalSample sample;
+
+    st.start();
+    while (samples[index]->pop(sample, waited)) {
+        // Sensor::reconfigure
+        ControlAction command;
+        while (commands[index]->tryPop(command)) {
+            if (command.command == ControlAction::FREQ) {
+                freq = command.value;
+            } else if (command.command == ControlAction::REPLICATE_COLLECT) {
+                int new_replicate_collect = static_cast<int>(command.value);
+                if (new_replicate_collect > 1 && new_replicate_collect < 200) replicate_collect = new_replicate_collect;
+            }
+        }
+
+        // samples between two cycles of the sensor are simply not collected
+        if (sample.time < next) continue;
+        next = sample.time + 1/freq;
+
+        Clock::time_point begin = Clock::now();
+
+        double data = sample.values[sensor.channel];
+        double collected_risk = sensor.config.evaluateNumber(data);
+
+        data = sensor.noise.replicate(data, options.noise_factor, replicate_collect);
+
+        sensor.filter.insert(data);
+        data = sensor.filter.getValue();
+
+        double risk = sensor.config.evaluateNumber(data);
+
+        Status status;
+        status.component = "/" + sensor.name;
+        status.time = sample.time;
+        status.success = risk >= 0 && risk <= 100 && sensor.config.label(risk) == sensor.config.label(collected_risk);
+
+        if (status.success) {
+            Reading reading;
+            reading.id = sensor.id;
+            reading.risk = risk;
+            reading.time = sample.time;
+            reading.created = sample.created;
+            readings->push(reading);
+        }
+        statuses->push(status);
+
+        st.record(seconds(Clock::now() - begin), waited);
+    }
+
+    readings->close();
+    statuses->close();
+    st.stop();
+}
+
+void Harness::hub() {
+    StageStats &st = stats[sensors.size() + 1];
+    std::vector<double> risks(6, -1);
+
+    double freq = options.hub_freq;
+    double next = 0;
+    double waited;
+    Reading reading;
+
+    st.start();
+    end_to_end.start();
+    while (readings->pop(reading, waited)) {
+        Clock::time_point begin = Clock::now();
+        end_to_end.record(seconds(begin - reading.created), 0);
+
+        ControlAction command;
+        while (commands[sensors.size()]->tryPop(command)) {
+            if (command.command == ControlAction::FREQ) freq = command.value;
+        }
+
+        if (reading.id >= 0 && reading.id < static_cast<int32_t>(risks.size())) risks[reading.id] = reading.risk;
+
+        if (reading.time >= next) {
+            next = reading.time + 1/freq;
+
+            double patient_status = bsn::processor::data_fuse(risks);
+
+            Status status;
+            status.component = "/g4t1";
+            status.time = reading.time;
+            status.success = patient_status >= 0 && patient_status <= 100;
+            statuses->push(status);
+        }
+
+        st.record(seconds(Clock::now() - begin), waited);
+    }
+
+    statuses->close();
+    end_to_end.stop();
+    st.stop();
+}
+
+/*
+ * DataAccess: keeps the statuses of the last 10.1 seconds and hands the
+ * reliability of every component to the engine and the enactor once per
+ * monitoring cycle.
+ */
+void Harness::knowledge() {
+    StageStats &st = stats[sensors.size() + 2];
+    std::map<std::string, StatusWindow> status;
+
+    double monitor_period = 1/params.getDouble("monitor_freq", 1);
+    double next = monitor_period;
+    double now = 0;
+    double waited;
+    Status s;
+
+    st.start();
+    while (statuses->pop(s, waited)) {
+        Clock::time_point begin = Clock::now();
+
+        // stages run at different paces, statuses are not ordered in time
+        now = std::max(now, s.time);
+        status[s.component].push(s.time, s.success ? "success" : "fail");
+
+        if (now >= next) {
+            next = now + monitor_period;
+
+            Control control;
+            control.strategy = false;
+
+            for (auto &component : status) {
+                component.second.slide(now);
+                control.values[component.first] = component.second.reliability();
+            }
+
+            reliabilities.push(control.values);
+            controls.push(control);
+        }
+
+        st.record(seconds(Clock::now() - begin), waited);
+    }
+
+    reliabilities.close();
+    controls.close();
+    st.stop();
+}
+
+/*
+ * ReliabilityEngine: monitor, analyze and plan on every reliability
+ * snapshot, sends the new references to the enactor when the search
+ * converges.
+ */
+void Harness::engine() {
+    StageStats &st = stats[sensors.size() + 3];
+    std::map<std::string, double> strategy;
+    std::map<std::string, int> priority;
+    std::map<std::string, int> deactivated;
+
+    ReliabilityPlanner planner(params.getDouble("setpoint", 0.9), params.getDouble("offset", 0.5), params.getDouble("gain", 0.01));
+    double monitor_freq = params.getDouble("monitor_freq", 1);
+    double actuation_freq = params.getDouble("actuation_freq", 1);
+    int cycles = 0;
+
+    for (const std::string &t : model.getTerms()) {
+        strategy[t] = 1;
+        if (t.find("R_") != std::string::npos) priority[t] = 50;
+    }
+
+    double waited;
+    std::map<std::string, double> snapshot;
+
+    st.start();
+    while (reliabilities.pop(snapshot, waited)) {
+        Clock::time_point begin = Clock::now();
+
+        // Engine::receiveException
+        std::string exception;
+        while (exceptions.tryPop(exception)) {
+            bsn::utils::StringView component, value;
+            if (!bsn::utils::split_once(exception, '=', component, value)) continue;
+
+            prioritize(priority, "R_" + term(component.str()), bsn::utils::to_int(value));
+        }
+
+        cycles++;
+
+        // every component is active in the harness, hence all contexts are set
+        for (std::map<std::string, double>::iterator it = strategy.begin(); it != strategy.end(); ++it) {
+            if (it->first.find("CTX_") != std::string::npos) it->second = 1;
+            if (it->first.find("R_") != std::string::npos) it->second = 1;
+            if (it->first.find("F_") != std::string::npos) it->second = 1;
+        }
+        for (auto const &r : snapshot) {
+            strategy["R_" + term(r.first)] = r.second;
+        }
+
+        model.setTermValueMap(strategy);
+        if (planner.off(model.evaluate())) {
+            if (cycles >= monitor_freq / actuation_freq) {
+                cycles = 0;
+
+                if (planner.plan(model, strategy, priority, deactivated)) {
+                    Control control;
+                    control.strategy = true;
+                    for (auto const &t : strategy) {
+                        if (t.first.find("R_") != std::string::npos) control.values[component(t.first)] = t.second;
+                    }
+                    controls.push(control);
+                }
+            }
+        }
+
+        st.record(seconds(Clock::now() - begin), waited);
+    }
+
+    controls.close();
+    st.stop();
+}
+
+/*
+ * Controller::apply_reli_strategy: proportional control of the frequency
+ * of every component (or of the replicas the sensors collect) towards the
+ * references planned by the engine.
+ */
+void Harness::enactor() {
+    StageStats &st = stats[sensors.size() + 4];
+    std::map<std::string, double> r_ref;
+    std::map<std::string, double> freq;
+    std::map<std::string, int> replicate_task;
+    std::map<std::string, int> exception_buffer;
+
+    ProportionalController controller(0.1, 40, 0.02);
+    bool replicate_collect = options.adaptation_parameter == "replicate_collect";
+    double kp = params.getDouble("kp", 200);
+    double waited;
+    Control control;
+
+    st.start();
+    while (controls.pop(control, waited)) {
+        Clock::time_point begin = Clock::now();
+
+        if (control.strategy) {
+            for (auto const &ref : control.values) r_ref[ref.first] = ref.second;
+        } else {
+            for (auto const &r_curr : control.values) {
+                const std::string &component = r_curr.first;
+                std::map<std::string, size_t>::const_iterator target = components.find(component);
+                if (target == components.end()) continue;
+
+                if (freq.find(component) == freq.end()) { // first status, as the activate event
+                    r_ref[component] = 1;
+                    freq[component] = (component == "/g4t1") ? options.hub_freq : options.sensor_freq;
+                    replicate_task[component] = 1;
+                    exception_buffer[component] = 0;
+                }
+
+                ControlAction action = controller.step(component == "/g4t1", replicate_collect, r_ref[component], r_curr.second, kp,
+                                                        freq[component], replicate_task[component], exception_buffer[component]);
+
+                if (action.command != ControlAction::NONE && commands[target->second]->tryPush(action)) adaptations++;
+                if (action.exception != 0) exceptions.tryPush(component + ((action.exception > 0) ? "=1" : "=-1"));
+            }
+        }
+
+        st.record(seconds(Clock::now() - begin), waited);
+    }
+
+    st.stop();
+}
+
+void Harness::run() {
+    // data_fuse reports every fusion on stdout, keep it quiet while measuring
+    std::cout.setstate(std::ios_base::failbit);
+    Clock::time_point begin = Clock::now();
+
+    std::vector<std::thread> threads;
+    threads.push_back(std::thread(&Harness::enactor, this));
+    threads.push_back(std::thread(&Harness::engine, this));
+    threads.push_back(std::thread(&Harness::knowledge, this));
+    threads.push_back(std::thread(&Harness::hub, this));
+    for (size_t i = 0; i < sensors.size(); ++i) {
+        threads.push_back(std::thread(&Harness::sensor, this, i));
+    }
+    threads.push_back(std::thread(&Harness::patient, this));
+
+    for (std::thread &t : threads) t.join();
+
+    wall_time = seconds(Clock::now() - begin);
+    std::cout.clear();
+}
+
+void Harness::report(std::ostream &os) const {
+    StageStats::printHeader(os);
+    for (const StageStats &st : stats) st.print(os);
+    end_to_end.print(os);
+
+    double simulated = options.ticks * tick_period;
+    os << std::endl;
+    os << "simulated " << simulated << "s in " << wall_time << "s (" << ((wall_time > 0) ? simulated / wall_time : 0) << "x real time), ";
+    os << adaptations << " adaptation commands" << std::endl;
+}
@@ -0,0 +1,66 @@
+#include "LaunchParams.hpp"
+
+#include <fstream>
+#include <regex>
+#include <sstream>
+
+LaunchParams::LaunchParams() : params() {}
+
+LaunchParams::~LaunchParams() {}
+
+LaunchParams::LaunchParams(const LaunchParams &obj) : params(obj.params) {}
+
+LaunchParams& LaunchParams::operator=(const LaunchParams &obj) {
+    params = obj.params;
+    return (*this);
+}
+
+namespace {
+    std::string attribute(const std::string &tag, const std::string &name) {
+        std::smatch match;
+        std::regex pattern(name + "\\s*=\\s*\"([^\"]*)\"");
+        return std::regex_search(tag, match, pattern) ? match[1].str() : "";
+    }
+}
+
+void LaunchParams::load(const std::string &path) {
+    std::ifstream file(path);
+    if (!file.is_open()) throw std::invalid_argument("could not read launch file " + path);
+
+    std::stringstream ss;
+    ss << file.rdbuf();
+    std::string text = std::regex_replace(ss.str(), std::regex("<!--[\\s\\S]*?-->"), "");
+
+    std::regex tags("<(/?)(node|param)\\b([^>]*?)(/?)>");
+    std::string node = "";
+
+    for (std::sregex_iterator it(text.begin(), text.end(), tags), end; it != end; ++it) {
+        const std::smatch &tag = *it;
+        bool closing = tag[1].length() > 0;
+        bool empty = tag[4].length() > 0;
+        std::string body = tag[3].str();
+
+        if (tag[2] == "node") {
+            if (closing) node = "";
+            else if (!empty) node = attribute(body, "name");
+        } else if (!closing) {
+            std::string name = attribute(body, "name");
+            if (name.empty()) continue;
+            params[node.empty() ? name : node + "/" + name] = attribute(body, "value");
+        }
+    }
+}
+
+bool LaunchParams::has(const std::string &key) const {
+    return params.find(key) != params.end();
+}
+
+std::string LaunchParams::get(const std::string &key) const {
+    std::map<std::string, std::string>::const_iterator it = params.find(key);
+    if (it == params.end()) throw std::out_of_range("missing parameter " + key);
+    return it->second;
+}
+
+double LaunchParams::getDouble(const std::string &key, const double &fallback) const {
+    return has(key) ? std::stod(get(key)) : fallback;
+}
@@ -0,0 +1,93 @@
+#include "StageStats.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+StageStats::StageStats(const std::string &name) : name(name), service(), total_service(0), total_wait(0), begin(), end() {}
+
+StageStats::~StageStats() {}
+
+StageStats::StageStats(const StageStats &obj) :
+    name(obj.name),
+    service(obj.service),
+    total_service(obj.total_service),
+    total_wait(obj.total_wait),
+    begin(obj.begin),
+    end(obj.end) {}
+
+StageStats& StageStats::operator=(const StageStats &obj) {
+    name = obj.name;
+    service = obj.service;
+    total_service = obj.total_service;
+    total_wait = obj.total_wait;
+    begin = obj.begin;
+    end = obj.end;
+    return (*this);
+}
+
+void StageStats::start() {
+    begin = Clock::now();
+    end = begin;
+}
+
+void StageStats::stop() {
+    end = Clock::now();
+}
+
+void StageStats::record(const double &service_time, const double &wait_time) {
+    service.push_back(service_time);
+    total_service += service_time;
+    total_wait += wait_time;
+}
+
+uint64_t StageStats::getItems() const {
+    return service.size();
+}
+
+double StageStats::getElapsed() const {
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+double StageStats::getThroughput() const {
+    double elapsed = getElapsed();
+    return (elapsed > 0) ? service.size() / elapsed : 0;
+}
+
+double StageStats::meanService() const {
+    return service.empty() ? 0 : total_service / service.size();
+}
+
+double StageStats::meanWait() const {
+    return service.empty() ? 0 : total_wait / service.size();
+}
+
+double StageStats::percentile(const double &q) const {
+    if (service.empty()) return 0;
+
+    std::vector<double> sorted(service);
+    size_t index = std::min(sorted.size() - 1, static_cast<size_t>(q * sorted.size()));
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+void StageStats::printHeader(std::ostream &os) {
+    os << std::left << std::setw(14) << "stage"
+       << std::right << std::setw(10) << "items"
+       << std::setw(14) << "items/s"
+       << std::setw(12) << "mean(us)"
+       << std::setw(12) << "p50(us)"
+       << std::setw(12) << "p99(us)"
+       << std::setw(12) << "wait(us)" << std::endl;
+}
+
+void StageStats::print(std::ostream &os) const {
+    os << std::left << std::setw(14) << name
+       << std::right << std::setw(10) << getItems()
+       << std::fixed << std::setprecision(1)
+       << std::setw(14) << getThroughput()
+       << std::setprecision(2)
+       << std::setw(12) << meanService() * 1e6
+       << std::setw(12) << percentile(0.5) * 1e6
+       << std::setw(12) << percentile(0.99) * 1e6
+       << std::setw(12) << meanWait() * 1e6 << std::endl;
+}
@@ -0,0 +1,6 @@
+#include "SimClock.hpp"
+
+int32_t main(int argc, char **argv) {    
+    SimClock clock(argc, argv, "sim_clock");
+    return clock.run();
+}
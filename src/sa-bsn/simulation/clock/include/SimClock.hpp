@@ -0,0 +1,66 @@
+#ifndef SIMCLOCK_HPP
+#define SIMCLOCK_HPP
+
+#include "ros/ros.h"
+
+#include <map>
+#include <string>
+
+#include "rosgraph_msgs/Clock.h"
+
+#include "archlib/Wakeup.h"
+#include "archlib/ROSComponent.hpp"
+
+/*
+ * Drives /clock when the system runs with /use_sim_time.
+ *
+ * Periodic components announce on /clock_schedule when they wake up next
+ * (ROSComponent::scheduleWakeup). Time only advances once every announced
+ * component is sleeping, and then jumps straight to the earliest wake-up,
+ * so experiments run as fast as the components can compute, instead of
+ * at wall-clock speed.
+ */
+class SimClock : public arch::ROSComponent {
+
+	public:
+    	SimClock(int &argc, char **argv, const std::string &name);
+    	virtual ~SimClock();
+
+    private:
+      	SimClock(const SimClock &);
+    	SimClock &operator=(const SimClock &);
+
+		bool isBlocked();
+		void publish();
+
+	public:
+		virtual void setUp();
+		virtual void tearDown();
+		virtual int32_t run();
+		virtual void body();
+
+		void receiveWakeup(const archlib::Wakeup::ConstPtr& msg);
+
+	private:
+		ros::NodeHandle handle;
+		ros::Publisher clock_pub;
+		ros::Subscriber wakeup_sub;
+
+		ros::Time now;
+		ros::Time start;
+		ros::WallTime wall_start;
+
+		// next wake-up of each component, and since when (wall time) it is overdue
+		std::map<std::string, ros::Time> wakeups;
+		std::map<std::string, ros::WallTime> due_since;
+
+		double resolution;
+		double max_step;
+		double speedup;
+		double duration;
+		double timeout;
+		int wait_for;
+		bool advanced;
+};
+
+#endif 
@@ -0,0 +1,112 @@
+#include "SimClock.hpp"
+
+#include <algorithm>
+
+SimClock::SimClock(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), now(1, 0), start(1, 0), wall_start(), wakeups(), due_since(), resolution(0.005), max_step(0.1), speedup(0), duration(0), timeout(10), wait_for(0), advanced(false) {}
+SimClock::~SimClock() {}
+
+void SimClock::setUp() {
+    ros::NodeHandle config("~");
+
+    // smallest jump of the clock, components waking up more often than that run once per jump
+    config.getParam("resolution", resolution);
+    // largest jump of the clock, bounds the time components that never announce may sleep through
+    config.getParam("max_step", max_step);
+    // at most speedup times faster than wall time (0 for as fast as possible)
+    config.getParam("speedup", speedup);
+    // simulated seconds after which the clock stops (0 for no limit)
+    config.getParam("duration", duration);
+    // wall seconds after which a component that does not announce its next wake-up is forgotten
+    config.getParam("timeout", timeout);
+    // number of components that must announce themselves before time starts running
+    config.getParam("wait_for", wait_for);
+
+    clock_pub = handle.advertise<rosgraph_msgs::Clock>("/clock", 10);
+    wakeup_sub = handle.subscribe("/clock_schedule", 1000, &SimClock::receiveWakeup, this);
+
+    publish();
+    wall_start = ros::WallTime::now();
+}
+
+void SimClock::tearDown() {}
+
+int32_t SimClock::run() {
+    setUp();
+
+    // paced by the components themselves, hence no ros::Rate here
+    while (ros::ok()) {
+        body();
+
+        // wait for announcements while blocked, otherwise just pick up what arrived
+        ros::getGlobalCallbackQueue()->callAvailable(ros::WallDuration(advanced ? 0 : 0.001));
+    }
+
+    tearDown();
+    return 0;
+}
+
+void SimClock::receiveWakeup(const archlib::Wakeup::ConstPtr& msg) {
+    wakeups[msg->source] = msg->Header.stamp;
+    due_since.erase(msg->source);
+}
+
+/*
+ * A component whose wake-up time has been reached is still running its
+ * cycle, time must not move until it announces the next one.
+ */
+bool SimClock::isBlocked() {
+    ros::WallTime wall_now = ros::WallTime::now();
+    bool blocked = false;
+
+    for (std::map<std::string, ros::Time>::iterator it = wakeups.begin(); it != wakeups.end();) {
+        if (it->second <= now) {
+            std::map<std::string, ros::WallTime>::iterator due = due_since.find(it->first);
+            if (due == due_since.end()) {
+                due_since[it->first] = wall_now;
+            } else if ((wall_now - due->second).toSec() > timeout) {
+                ROS_WARN("%s did not announce its next wake-up, ignoring it", it->first.c_str());
+                due_since.erase(due);
+                it = wakeups.erase(it);
+                continue;
+            }
+            blocked = true;
+        }
+        ++it;
+    }
+
+    return blocked;
+}
+
+void SimClock::body() {
+    advanced = false;
+
+    if (static_cast<int>(wakeups.size()) < wait_for || isBlocked()) return;
+
+    ros::Time next = now + ros::Duration(max_step);
+    for (const std::pair<const std::string, ros::Time> &wakeup : wakeups) {
+        next = std::min(next, wakeup.second);
+    }
+    next = std::max(next, now + ros::Duration(resolution));
+
+    if (duration > 0 && (next - start).toSec() > duration) {
+        ROS_INFO("Simulated %.2f seconds in %.2f wall seconds", duration, (ros::WallTime::now() - wall_start).toSec());
+        ros::shutdown();
+        return;
+    }
+
+    if (speedup > 0) {
+        ros::WallTime due = wall_start + ros::WallDuration((next - start).toSec() / speedup);
+        ros::WallTime wall_now = ros::WallTime::now();
+        if (due > wall_now) (due - wall_now).sleep();
+    }
+
+    now = next;
+    publish();
+    advanced = true;
+}
+
+void SimClock::publish() {
+    rosgraph_msgs::Clock msg;
+    msg.clock = now;
+    clock_pub.publish(msg);
+}
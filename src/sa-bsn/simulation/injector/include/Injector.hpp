@@ -12,6 +12,8 @@
 #include "archlib/ROSComponent.hpp"
 
 #include "libbsn/utils/utils.hpp"
+#include "libbsn/random/Philox.hpp"
+#include "libbsn/random/Seed.hpp"
 
 class Injector : public arch::ROSComponent {
 
@@ -53,6 +55,7 @@ class Injector : public arch::ROSComponent {
 
 
 		ros::Publisher log_uncertainty;
+		bsn::random::Philox rng;
 };
 
 #endif 
\ No newline at end of file
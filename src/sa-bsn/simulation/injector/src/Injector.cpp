@@ -1,17 +1,19 @@
 #include "Injector.hpp"
 
 
-Injector::Injector(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), cycles(0), duration(), frequency(), amplitude(), noise_factor(), begin(), end(), type() {}
+Injector::Injector(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), cycles(0), duration(), frequency(), amplitude(), noise_factor(), begin(), end(), type(), rng() {}
 Injector::~Injector() {}
 
 void Injector::setUp() {
-    srand(time(NULL));
+    int seed;
+    rng.seed(handle.getParam("seed", seed) ? bsn::random::seed_for(seed, "/injector") : bsn::random::random_seed());
+
     log_uncertainty = handle.advertise<archlib::Uncertainty>("log_uncertainty", 10);
 
     ros::NodeHandle config;
     
     double freq;
-    config.getParam("frequency", freq);
+    getParam("frequency", freq);
     rosComponentDescriptor.setFreq(freq);
 
     std::string comps;
@@ -51,7 +53,7 @@ double Injector::gen_noise(const std::string &component, double &noise, int &dur
     } else if (type=="ramp" && !is_last_cycle) {
         return noise + amplitude/seconds_in_cycles(duration);
     } else if (type=="random") {
-        return ((double) rand() / (RAND_MAX)) * amplitude;
+        return rng.uniform() * amplitude;
     } 
     
     return 0.0;
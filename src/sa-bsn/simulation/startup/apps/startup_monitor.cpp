@@ -0,0 +1,6 @@
+#include "StartupMonitor.hpp"
+
+int32_t main(int argc, char **argv) {    
+    StartupMonitor monitor(argc, argv, "startup_monitor");
+    return monitor.run();
+}
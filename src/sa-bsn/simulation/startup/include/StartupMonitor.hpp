@@ -0,0 +1,56 @@
+#ifndef STARTUPMONITOR_HPP
+#define STARTUPMONITOR_HPP
+
+#include "ros/ros.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "archlib/Status.h"
+#include "archlib/ROSComponent.hpp"
+
+/*
+ * Reports how long the SA-BSN takes to reach steady state when all of its
+ * nodes are launched at once (configurations/bsn.launch): the time until
+ * each service the nodes wait for is advertised, until each component
+ * sends its first sample (a "success" status), and until all of that has
+ * happened. It shuts itself down once it has reported.
+ *
+ * Times are wall seconds since the monitor started, which roslaunch does
+ * together with the other nodes.
+ */
+class StartupMonitor : public arch::ROSComponent {
+
+	public:
+    	StartupMonitor(int &argc, char **argv, const std::string &name);
+    	virtual ~StartupMonitor();
+
+    private:
+      	StartupMonitor(const StartupMonitor &);
+    	StartupMonitor &operator=(const StartupMonitor &);
+
+		double elapsed() const;
+
+	public:
+		virtual void setUp();
+		virtual void tearDown();
+		virtual int32_t run();
+		virtual void body();
+
+		void receiveStatus(const archlib::Status::ConstPtr& msg);
+
+	private:
+		ros::NodeHandle handle;
+		ros::Subscriber status_sub;
+
+		ros::WallTime start;
+
+		// services not advertised yet
+		std::vector<std::string> services;
+		// components that have not sent a sample yet, and when the others did
+		std::vector<std::string> components;
+		std::map<std::string, double> first_sample;
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "StartupMonitor.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace {
+    std::vector<std::string> list(const std::string &s) {
+        std::vector<std::string> items;
+        std::istringstream stream(s);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (!item.empty()) items.push_back(item);
+        }
+        return items;
+    }
+}
+
+StartupMonitor::StartupMonitor(int  &argc, char **argv, const std::string &name) : ROSComponent(argc, argv, name), start(ros::WallTime::now()), services(), components(), first_sample() {}
+StartupMonitor::~StartupMonitor() {}
+
+void StartupMonitor::setUp() {
+    ros::NodeHandle config("~");
+
+    std::string s = "DataAccessRequest,EngineRequest,EffectorRegister,getPatientData";
+    config.getParam("services", s);
+    services = list(s);
+
+    s = "g3t1_1,g3t1_2,g3t1_3,g3t1_4,g3t1_5,g3t1_6,g4t1";
+    config.getParam("components", s);
+    for (const std::string &component : list(s)) {
+        components.push_back(component[0] == '/' ? component : "/" + component);
+    }
+
+    // relayed by the logger or sent by the probe, depending on direct_control
+    status_sub = handle.subscribe("status", 1000, &StartupMonitor::receiveStatus, this);
+}
+
+void StartupMonitor::tearDown() {}
+
+int32_t StartupMonitor::run() {
+    setUp();
+
+    // on wall time, under /use_sim_time it must not hold the simulated clock back
+    while (ros::ok()) {
+        ros::getGlobalCallbackQueue()->callAvailable(ros::WallDuration(0.01));
+        body();
+    }
+
+    tearDown();
+    return 0;
+}
+
+double StartupMonitor::elapsed() const {
+    return (ros::WallTime::now() - start).toSec();
+}
+
+void StartupMonitor::receiveStatus(const archlib::Status::ConstPtr& msg) {
+    if (msg->content != "success") return;
+
+    std::vector<std::string>::iterator it = std::find(components.begin(), components.end(), msg->source);
+    if (it == components.end()) return;
+
+    first_sample[msg->source] = elapsed();
+    ROS_INFO("First sample of %s after %.3f s", msg->source.c_str(), first_sample[msg->source]);
+    components.erase(it);
+}
+
+void StartupMonitor::body() {
+    for (std::vector<std::string>::iterator it = services.begin(); it != services.end();) {
+        if (ros::service::exists(*it, false)) {
+            ROS_INFO("%s available after %.3f s", it->c_str(), elapsed());
+            it = services.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (!services.empty() || !components.empty()) return;
+
+    double first = elapsed(), last = 0;
+    for (const std::pair<const std::string, double> &sample : first_sample) {
+        first = std::min(first, sample.second);
+        last = std::max(last, sample.second);
+    }
+    ROS_INFO("Steady state after %.3f s, %.3f s between the first and the last component", elapsed(), first_sample.empty() ? 0 : last - first);
+
+    ros::shutdown();
+}
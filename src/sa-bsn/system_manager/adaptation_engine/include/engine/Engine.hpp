@@ -18,6 +18,7 @@
 #include "libbsn/goalmodel/LeafTask.hpp"
 #include "libbsn/goalmodel/Context.hpp"
 #include "libbsn/goalmodel/GoalTree.hpp"
+#include "libbsn/control/ReliabilityPlanner.hpp"
 #include "libbsn/model/Formula.hpp"
 #include "libbsn/utils/utils.hpp"
 
@@ -75,6 +76,8 @@ class Engine : public arch::ROSComponent {
 		std::map<std::string, double> strategy;
 		std::map<std::string, int> priority;
 		std::map<std::string, int> deactivatedComponents;
+		// trace of the newest status the knowledge repository answered with
+		std::string trace;
 
 		ros::ServiceServer enactor_server;
 };
@@ -18,6 +18,7 @@
 #include "libbsn/goalmodel/LeafTask.hpp"
 #include "libbsn/goalmodel/Context.hpp"
 #include "libbsn/goalmodel/GoalTree.hpp"
+#include "libbsn/control/ReliabilityPlanner.hpp"
 #include "libbsn/model/Formula.hpp"
 #include "libbsn/utils/utils.hpp"
 
@@ -98,26 +98,29 @@ void CostEngine::monitor() {
     
     //expecting smth like: "/g3t1_1:success,fail,success;/g4t1:success; ..."
     std::string ans = r_srv.response.content;
+    trace = r_srv.response.trace;
+    tracer.record(trace, "analyze");
 
     if(ans == ""){
         ROS_ERROR("Received empty answer when asked for cost.");
     }
 
-    std::vector<std::string> pairs = bsn::utils::split(ans, ';');
-    
-    for (std::string it : pairs) {
-        std::vector<std::string> pair = bsn::utils::split(it, ':');
-        std::string first = pair[0];
-        std::string second = pair[1];
+    bsn::utils::StringView name, second;
+
+    for (bsn::utils::StringView it : bsn::utils::Tokenizer(ans, ';')) {
+        if (!bsn::utils::split_once(it, ':', name, second)) continue;
+        std::string first = name.str();
 
         //a "/g3t1_1 arrives here"
         std::transform(first.begin(), first.end(),first.begin(), ::toupper); // /G3T1_1
         first.erase(0,1); // G3T1_1
         first.insert(int(first.find('T')),"_"); // G3_T1_1
 
-        std::vector<std::string> values = bsn::utils::split(second, ',');
+        // the latest value is the last one
+        bsn::utils::StringView last;
+        for (bsn::utils::StringView value : bsn::utils::Tokenizer(second, ',')) last = value;
 
-        strategy["W_" + first] = stod(values[values.size()-1]);
+        strategy["W_" + first] = bsn::utils::to_double(last);
         std::cout << "W_" + first + " = " << strategy["W_" + first] << std::endl;
     } 
 
@@ -139,20 +142,16 @@ void CostEngine::monitor() {
         ROS_ERROR("Received empty answer when asked for event.");
     }
 
-    std::vector<std::string> ctx_pairs = bsn::utils::split(ans, ';');
-    
-    for (std::string ctx : ctx_pairs) {
-        std::vector<std::string> pair = bsn::utils::split(ctx, ':');
-        std::string first = pair[0];
-        std::string second = pair[1];
+    for (bsn::utils::StringView ctx : bsn::utils::Tokenizer(ans, ';')) {
+        if (!bsn::utils::split_once(ctx, ':', name, second)) continue;
+        std::string first = name.str();
 
         //a "/g3t1_1 arrives here"
         std::transform(first.begin(), first.end(),first.begin(), ::toupper); // /G3T1_1
         first.erase(0,1); // G3T1_1
         first.insert(int(first.find('T')),"_"); // G3_T1_1
 
-        std::vector<std::string> values = bsn::utils::split(second, ',');
-        for (std::string value : values) {
+        for (bsn::utils::StringView value : bsn::utils::Tokenizer(second, ',')) {
             if (first != "G4_T1") {
                 strategy["CTX_" + first] = 1;
                 
@@ -447,7 +446,9 @@ void CostEngine::execute() {
     msg.source = "/engine";
     msg.target = "/enactor";
     msg.content = content;
+    msg.Header.frame_id = trace;
 
+    tracer.record(trace, "plan");
     enact.publish(msg);
 
     std::cout << "[ " << content << "]" << std::endl;
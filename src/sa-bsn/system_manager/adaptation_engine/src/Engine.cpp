@@ -2,7 +2,7 @@
 
 using namespace bsn::goalmodel;
 
-Engine::Engine(int  &argc, char **argv, std::string name): ROSComponent(argc, argv, name), info_quant(0), monitor_freq(1), actuation_freq(1), target_system_model(), strategy(),  priority() {}
+Engine::Engine(int  &argc, char **argv, std::string name): ROSComponent(argc, argv, name), info_quant(0), monitor_freq(1), actuation_freq(1), target_system_model(), strategy(),  priority(), trace() {}
 
 Engine::~Engine() {}
 
@@ -16,11 +16,14 @@ void Engine::setUp() {
 
     rosComponentDescriptor.setFreq(monitor_freq);
 
-    std::string formula_str = "";
-    do{
+    // the knowledge repository loads the formulas before advertising its service
+    waitForService("DataAccessRequest");
+
+    std::string formula_str = fetch_formula(qos_attribute);
+    for (double backoff = 0.01; formula_str == "" && ros::ok(); backoff = std::min(2 * backoff, 1.0)) {
+        ros::WallDuration(backoff).sleep();
         formula_str = fetch_formula(qos_attribute);
-        ros::Duration(1.0).sleep() ;
-    } while(formula_str=="");
+    }
     
     setUp_formula(formula_str);
 
@@ -36,22 +39,17 @@ bool Engine::sendAdaptationParameter(archlib::EngineRequest::Request &req, archl
 }
 
 void Engine::receiveException(const archlib::Exception::ConstPtr& msg){
-    std::string content = msg->content.c_str();
-
-    std::vector<std::string> param = bsn::utils::split(content, '=');
+    bsn::utils::StringView component, value;
+    if (!bsn::utils::split_once(msg->content, '=', component, value)) return;
 
     // /g3t1_1
-    std::string first = param[0];
+    std::string first = component.str();
     std::transform(first.begin(), first.end(),first.begin(), ::toupper); // /G3T1_1
     first.erase(0,1); // G3T1_1
     first.insert(int(first.find('T')), "_"); // G3_T1_1
     first = get_prefix() + first; 
 
-    if (priority.find(first) != priority.end()) {
-        priority[first] += stoi(param[1]);
-        if (priority[first] > 99) priority[first] = 100;
-        if (priority[first] < 1) priority[first] = 0;
-    } else {
+    if (!bsn::control::prioritize(priority, first, bsn::utils::to_int(value))) {
         ROS_ERROR("COULD NOT FIND COMPONENT IN LIST OF PRIORITIES.");
     }
 }
@@ -122,9 +120,9 @@ void Engine::body(){
     ros::NodeHandle n;
     ros::Subscriber t_sub = n.subscribe("exception", 1000, &Engine::receiveException, this);
 
-    ros::Rate loop_rate(rosComponentDescriptor.getFreq());
     int update=0;
     while (ros::ok){
+        perf.mark(arch::PerfCounters::BODY);
         update++;
         if (update >= rosComponentDescriptor.getFreq()*10){
             update = 0;
@@ -135,8 +133,12 @@ void Engine::body(){
 
         monitor();
 
+        perf.mark(arch::PerfCounters::SPIN);
         ros::spinOnce();
-        loop_rate.sleep();        
+        perf.backlog(!ros::getGlobalCallbackQueue()->isEmpty());
+        perf.mark(arch::PerfCounters::SLEEP);
+        waitNextCycle();
+        endCycle(loop.getFreq());
     }   
 
     return;
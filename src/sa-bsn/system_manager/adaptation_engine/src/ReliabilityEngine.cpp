@@ -2,17 +2,6 @@
 
 using namespace bsn::goalmodel;
 
-struct comp{
-    template<typename T>
-    bool operator()(const T& l, const T& r) const
-    {
-        if (l.second != r.second)
-            return l.second < r.second;
- 
-        return l.first < r.first;
-    }
-};
-
 ReliabilityEngine::ReliabilityEngine(int  &argc, char **argv, std::string name): Engine(argc, argv, name), setpoint(), offset(), gain(), tolerance(0.02), prefix("R_"), enact() {}
 
 ReliabilityEngine::~ReliabilityEngine() {}
@@ -96,26 +85,29 @@ void ReliabilityEngine::monitor() {
     
     //expecting smth like: "/g3t1_1:success,fail,success;/g4t1:success; ..."
     std::string ans = r_srv.response.content;
+    trace = r_srv.response.trace;
+    tracer.record(trace, "analyze");
     // std::cout << "received=> [" << ans << "]" << std::endl;
     if(ans == ""){
         ROS_ERROR("Received empty answer when asked for reliability.");
     }
 
-    std::vector<std::string> pairs = bsn::utils::split(ans, ';');
-    
-    for (std::string it : pairs) {
-        std::vector<std::string> pair = bsn::utils::split(it, ':');
-        std::string first = pair[0];
-        std::string second = pair[1];
+    bsn::utils::StringView name, second;
+
+    for (bsn::utils::StringView it : bsn::utils::Tokenizer(ans, ';')) {
+        if (!bsn::utils::split_once(it, ':', name, second)) continue;
+        std::string first = name.str();
 
         //a "/g3t1_1 arrives here"
         std::transform(first.begin(), first.end(),first.begin(), ::toupper); // /G3T1_1
         first.erase(0,1); // G3T1_1
         first.insert(int(first.find('T')),"_"); // G3_T1_1
 
-        std::vector<std::string> values = bsn::utils::split(second, ',');
+        // the latest value is the last one
+        bsn::utils::StringView last;
+        for (bsn::utils::StringView value : bsn::utils::Tokenizer(second, ',')) last = value;
 
-        strategy["R_" + first] = stod(values[values.size()-1]);
+        strategy["R_" + first] = bsn::utils::to_double(last);
         std::cout << "R_" + first + " = " << strategy["R_" + first] << std::endl;
     } 
 
@@ -137,20 +129,16 @@ void ReliabilityEngine::monitor() {
         ROS_ERROR("Received empty answer when asked for event.");
     }
 
-    std::vector<std::string> ctx_pairs = bsn::utils::split(ans, ';');
-    
-    for (std::string ctx : ctx_pairs) {
-        std::vector<std::string> pair = bsn::utils::split(ctx, ':');
-        std::string first = pair[0];
-        std::string second = pair[1];
+    for (bsn::utils::StringView ctx : bsn::utils::Tokenizer(ans, ';')) {
+        if (!bsn::utils::split_once(ctx, ':', name, second)) continue;
+        std::string first = name.str();
 
         //a "/g3t1_1 arrives here"
         std::transform(first.begin(), first.end(),first.begin(), ::toupper); // /G3T1_1
         first.erase(0,1); // G3T1_1
         first.insert(int(first.find('T')),"_"); // G3_T1_1
 
-        std::vector<std::string> values = bsn::utils::split(second, ',');
-        for (std::string value : values) {
+        for (bsn::utils::StringView value : bsn::utils::Tokenizer(second, ',')) {
             if (first != "G4_T1") {
                 strategy["CTX_" + first] = 1;
                 
@@ -182,14 +170,10 @@ void ReliabilityEngine::analyze() {
     //   std::cout<< itt->first << ":" << itt->second << ", ";
     //}
 
-    double r_curr;
-    double error;
-
-    r_curr = calculate_qos(target_system_model,strategy);
+    bsn::control::ReliabilityPlanner planner(setpoint, offset, gain, tolerance);
 
-    error = setpoint - r_curr;
     // if the error is out of the stability margin, plan!
-    if ((error > setpoint * tolerance) || (error < -tolerance * setpoint)) {
+    if (planner.off(calculate_qos(target_system_model,strategy))) {
         if (cycles >= monitor_freq / actuation_freq) {
             cycles = 0;
             plan();
@@ -207,121 +191,20 @@ void ReliabilityEngine::plan() {
     double error = setpoint - r_curr;
     std::cout << "error= " << error << std::endl;
 
-    //reset the formula_str
-    std::vector<std::string> r_vec;
-    for (std::map<std::string,double>::iterator it = strategy.begin(); it != strategy.end(); ++it) {
-        if(it->first.find("R_") != std::string::npos) {
-            std::string task = it->first;
-            task.erase(0,2);
-            if((strategy["CTX_"+task] != 0) && (strategy["F_"+task] != 0)){ // avoid ctx = 0 components thus infinite loops
-                if(!deactivatedComponents[it->first]) {
-                    r_vec.push_back(it->first);
-                    strategy[it->first] = r_curr;
-                } else {
-                    strategy[it->first] = 1;
-                }
-            }
-        }
-    }  
-
-    //reorder r_vec based on priority
-    std::vector<std::string> aux = r_vec;
-    r_vec.clear();
-    std::set<std::pair<std::string,int>, comp> set(priority.begin(), priority.end());
+    bsn::control::ReliabilityPlanner planner(setpoint, offset, gain, tolerance);
+    bool converged = planner.plan(target_system_model, strategy, priority, deactivatedComponents);
 
-    for (auto const &pair : set) {
-        if (!deactivatedComponents[pair.first] && std::find(aux.begin(), aux.end(), pair.first) != aux.end()) { // key from priority exists in r_vec
-            r_vec.push_back(pair.first);
+    std::cout << "strategy: [";
+    for (std::map<std::string,double>::iterator itt = strategy.begin(); itt != strategy.end(); ++itt) {
+        if(itt->first.find("R_") != std::string::npos) {
+            std::cout<< itt->first << ":" << itt->second << ", ";
         }
     }
+    std::cout << "] = " << calculate_qos(target_system_model,strategy) << std::endl;
 
-    //print ordered r_vec
-    std::cout << "ordered r_vec: [";
-    for(std::vector<std::string>::iterator i = r_vec.begin(); i != r_vec.end(); ++i) { 
-        std::cout << *i << ", ";
-    }
-    std::cout << "]" << std::endl;
-
-    // ladies and gentleman, the search...
-
-    std::vector<std::map<std::string, double>> solutions;
-    for(std::vector<std::string>::iterator i = r_vec.begin(); i != r_vec.end(); ++i) { 
-        //std::cout <<"i: "<< *i << std::endl;
-
-        //reset offset
-        for (std::vector<std::string>::iterator it = r_vec.begin(); it != r_vec.end(); ++it) {
-            if(error>0){
-                strategy[*it] = r_curr*(1-offset);
-            } else if(error<0) {
-                strategy[*it] = (r_curr*(1+offset)>1)?1:r_curr*(1+offset);
-            }
-        }
-        double r_new = calculate_qos(target_system_model,strategy);
-        std::cout << "offset=" << r_new << std::endl;
-
-        std::map<std::string,double> prev;
-        double r_prev=0;
-        if(error > 0){
-            do {
-                prev = strategy;
-                r_prev = r_new;
-                strategy[*i] += gain*error;
-                r_new = calculate_qos(target_system_model,strategy);
-            } while(r_new < setpoint && r_prev < r_new && strategy[*i] > 0 && strategy[*i] < 1);
-        } else if (error < 0){
-            do {
-                prev = strategy;
-                r_prev = r_new;
-                strategy[*i] += gain*error;
-                r_new = calculate_qos(target_system_model,strategy);
-            } while(r_new > setpoint && r_prev > r_new && strategy[*i] > 0 && strategy[*i] < 1);
-        }
-
-        strategy = prev;
-        r_new = calculate_qos(target_system_model,strategy);
-
-        for(std::vector<std::string>::iterator j = r_vec.begin(); j != r_vec.end(); ++j) { // all the others
-            if(*i == *j) continue;
-            //std::cout <<"j: "<< *j << std::endl;
-
-            if(error > 0){
-                do {
-                    prev = strategy;
-                    r_prev = r_new;
-                    strategy[*j] += gain*error;
-                    r_new = calculate_qos(target_system_model,strategy);
-                } while(r_new < setpoint && r_prev < r_new && strategy[*j] > 0 && strategy[*j] < 1);
-            } else if (error < 0) {
-                do {
-                    prev = strategy;
-                    r_prev = r_new;
-                    strategy[*j] += gain*error;
-                    r_new = calculate_qos(target_system_model,strategy);
-                } while(r_new > setpoint && r_prev > r_new && strategy[*j] > 0 && strategy[*j] < 1);
-            }
-            
-            strategy = prev;
-            r_new = calculate_qos(target_system_model,strategy);
-        }
-        solutions.push_back(strategy);
-    }
-
-    for (std::vector<std::map<std::string,double>>::iterator it = solutions.begin(); it != solutions.end(); it++){
-        strategy = *it;
-        double r_new = calculate_qos(target_system_model,strategy);
-
-        std::cout << "strategy: [";
-        for (std::map<std::string,double>::iterator itt = (*it).begin(); itt != (*it).end(); ++itt) {
-            if(itt->first.find("R_") != std::string::npos) {
-                std::cout<< itt->first << ":" << itt->second << ", ";
-            }
-        }
-        std::cout << "] = " << r_new << std::endl;
-
-        if(/*!blacklisted(*it) && */(r_new > setpoint*(1-tolerance) && r_new < setpoint*(1+tolerance))){ // if not listed and converges, yay!
-            execute();
-            return;
-        }
+    if (converged) {
+        execute();
+        return;
     }
 
     ROS_INFO("Did not converge :(");
@@ -368,7 +251,9 @@ void ReliabilityEngine::execute() {
     msg.source = "/engine";
     msg.target = "/enactor";
     msg.content = content;
+    msg.Header.frame_id = trace;
 
+    tracer.record(trace, "plan");
     enact.publish(msg);
 
     std::cout << "[ " << content << "]" << std::endl;
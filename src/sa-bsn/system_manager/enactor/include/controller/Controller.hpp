@@ -1,7 +1,10 @@
 #ifndef CONTROLLER_HPP
 #define CONTROLLER_HPP
 
+#include "libbsn/control/ProportionalController.hpp"
+
 #include "enactor/Enactor.hpp"
+#include "archlib/AdaptationCommands.hpp"
 
 class Controller : public Enactor {
     public:
@@ -20,10 +23,16 @@ class Controller : public Enactor {
         virtual void receiveEvent(const archlib::Event::ConstPtr& msg);
 
     private:
+        // sends the command and the exception a step of the control asked for
+        void enact(const std::string &component, const bsn::control::ControlAction &action);
+
         std::string adaptation_parameter;
         double KP;
         std::map<std::string, double> kp;
 
+        bsn::control::ProportionalController reliability_control;
+        bsn::control::ProportionalController cost_control;
+
 };
 
 #endif
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "archlib/Strategy.h"
 #include "archlib/Exception.h"
 #include "archlib/AdaptationCommand.h"
+#include "archlib/AdaptationCommandSet.h"
 
 #include "archlib/DataAccessRequest.h"
 #include "archlib/ROSComponent.hpp"
@@ -43,11 +44,19 @@ class Enactor : public arch::ROSComponent {
 		virtual void apply_cost_strategy(const std::string &component) = 0;
 
 		void print();
+
+	protected:
+		// publishes the commands decided in this cycle as one batch
+		void sendAdaptationCommands();
 	
 	protected:
 		ros::Publisher adapt;
 		ros::Publisher except;
 
+		archlib::AdaptationCommandSet commands;
+		// trace of the last strategy, carried by the commands that follow it
+		std::string trace;
+
 		std::map<std::string, std::deque<int>> invocations; //a map of deques where 1s represent successes and 0s represents failures
 		std::map<std::string, int> exception_buffer;
 		std::map<std::string, double> freq;
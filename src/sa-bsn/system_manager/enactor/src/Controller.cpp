@@ -2,23 +2,35 @@
 
 #include <iostream>
 
-Controller::Controller(int &argc, char **argv, std::string name) : Enactor(argc, argv, name) {}
+Controller::Controller(int &argc, char **argv, std::string name) :
+    Enactor(argc, argv, name),
+    adaptation_parameter(),
+    KP(),
+    kp(),
+    reliability_control(0.1, 40, stability_margin),
+    cost_control(0.5, 25, stability_margin) {}
 
 Controller::~Controller() {}
 
 void Controller::setUp() {
     ros::NodeHandle nh;
 
-    adapt = nh.advertise<archlib::AdaptationCommand>("log_adapt", 10);
+    // with direct_control the commands go straight to the effector and the
+    // logger only taps them, otherwise the logger relays them
+    bool direct_control = false;
+    nh.getParam("direct_control", direct_control);
+    adapt = nh.advertise<archlib::AdaptationCommandSet>(direct_control ? "reconfigure" : "log_adapt", 10);
 
     except = nh.advertise<archlib::Exception>("exception", 10);
 
     double freq;
-	nh.getParam("frequency", freq);
-    nh.getParam("kp", KP);
+	getParam("frequency", freq);
+    getParam("kp", KP);
     nh.getParam("adaptation_parameter", adaptation_parameter);
 	rosComponentDescriptor.setFreq(freq);
 
+    // the engine answers once it has its formula
+    waitForService("EngineRequest");
     receiveAdaptationParameter();
 }
 
@@ -60,93 +72,9 @@ void Controller::apply_reli_strategy(const std::string &component) {
     std::cout << "r_curr[" << component << "] = "<< r_curr[component] <<std::endl;
     std::cout << "kp[" << component << "] = "<< kp[component] <<std::endl;
 
-    double error = r_ref[component] - r_curr[component]; //error = Rref - Rcurr
-
-    if(error > stability_margin*r_ref[component] || error < stability_margin*r_ref[component]) {
-
-        exception_buffer[component] = (exception_buffer[component] < 0) ? 0 : exception_buffer[component] + 1;
-
-        if(component == "/g4t1"){
-            // g4t1 reliability is inversely proportional to the sensors frequency
-            /*
-                Nota:
-
-                -> Quando o componente é a Centralhub, adaptamos as frequências dos sensores. Porquê?
-            */
-            /*for (std::map<std::string, double>::iterator it = freq.begin(); it != freq.end(); ++it){
-                if(it->first != "/g4t1"){
-                    freq[it->first] += (error>0) ? ((-kp[it->first]/100) * error) : ((kp[it->first]/100) * error); 
-                    if(freq[(it->first)] <= 0) break;
-                    archlib::AdaptationCommand msg;
-                    msg.source = ros::this_node::getName();
-                    msg.target = it->first;
-                    msg.action = "freq=" + std::to_string(freq[(it->first)]);
-                    adapt.publish(msg);
-                }
-            }*/
-            //double new_freq = freq[component] + ((error>0) ? ((-kp[component]/100) * error) : ((kp[component]/100) * error)); 
-            double new_freq = freq[component] + ((kp[component]/100) * error);
-            if(new_freq > 0) {
-                freq[component] = new_freq;
-                archlib::AdaptationCommand msg;
-                msg.source = ros::this_node::getName();
-                msg.target = component;
-                msg.action = "freq=" + std::to_string(freq[component]);
-                adapt.publish(msg);
-                /*std::cout << "################################################" << std::endl;
-                std::cout << "Adapting Centralhub" << std::endl;
-                std::cout << "Action: " << msg.action << std::endl;
-                std::cout << "################################################" << std::endl;*/
-            } /*else {
-                std::cout << "################################################" << std::endl;
-                std::cout << "COULD NOT ADAPT CENTRALHUB"<< std::endl;
-                std::cout << "Calculated frequency: " << new_freq << std::endl;
-                std::cout << "################################################" << std::endl;
-            }*/
-        } else {
-            if(adaptation_parameter == "replicate_collect") {
-                replicate_task[component] += (error > 0) ? ceil(kp[component] * error) : floor(kp[component] * error);
-                if (replicate_task[component] < 1) replicate_task[component] = 1;
-                archlib::AdaptationCommand msg;
-                msg.source = ros::this_node::getName();
-                msg.target = component;
-                msg.action = "replicate_collect=" + std::to_string(replicate_task[(component)]);
-                adapt.publish(msg);
-            } else {
-                //freq[component] += (error>0) ? ((-kp[component]/100) * error) : ((kp[component]/100) * error); 
-                //double new_freq = freq[component] + ((error>0) ? ((-kp[component]/100) * error) : ((kp[component]/100) * error));
-                double new_freq = freq[component] + ((kp[component]/100) * error);
-                if(new_freq >= 0.1 && new_freq <= 40) {
-                    freq[component] = new_freq;
-                    archlib::AdaptationCommand msg;
-                    msg.source = ros::this_node::getName();
-                    msg.target = component;
-                    msg.action = "freq=" + std::to_string(freq[component]);
-                    adapt.publish(msg);
-                }
-            }
-        }
-    } else {
-        exception_buffer[component] = (exception_buffer[component] > 0) ? 0 : exception_buffer[component] - 1;
-    }
-
-    if(exception_buffer[component]>4){
-        archlib::Exception msg;
-        msg.source = ros::this_node::getName();
-        msg.target = "/engine";
-        msg.content = component+"=1";
-        except.publish(msg);
-        exception_buffer[component] = 0;
-    } else if (exception_buffer[component]<-4) {
-        archlib::Exception msg;
-        msg.source = ros::this_node::getName();
-        msg.target = "/engine";
-        msg.content = component+"=-1";
-        except.publish(msg);
-        exception_buffer[component] = 0;
-    }
-    
-    invocations[component].clear();
+    enact(component, reliability_control.step(component == "/g4t1", adaptation_parameter == "replicate_collect",
+                                              r_ref[component], r_curr[component], kp[component],
+                                              freq[component], replicate_task[component], exception_buffer[component]));
 }
 
 void Controller::apply_cost_strategy(const std::string &component) {
@@ -154,91 +82,28 @@ void Controller::apply_cost_strategy(const std::string &component) {
     std::cout << "c_curr[" << component << "] = "<< c_curr[component] <<std::endl;
     std::cout << "kp[" << component << "] = "<< kp[component] <<std::endl;
 
-    double error = c_ref[component] - c_curr[component]; //error = Cref - Ccurr
-
-    if(error > stability_margin*c_ref[component] || error < stability_margin*c_ref[component]) {
-
-        exception_buffer[component] = (exception_buffer[component] < 0) ? 0 : exception_buffer[component] + 1;
-
-        if(component == "/g4t1"){
-            // g4t1 reliability is inversely proportional to the sensors frequency
-            /*
-                Nota:
-
-                -> Quando o componente é a Centralhub, adaptamos as frequências dos sensores. Porquê?
-            */
-            /*for (std::map<std::string, double>::iterator it = freq.begin(); it != freq.end(); ++it){
-                if(it->first != "/g4t1"){
-                    freq[it->first] += (error>0) ? ((-kp[it->first]/100) * error) : ((kp[it->first]/100) * error); 
-                    if(freq[(it->first)] <= 0) break;
-                    archlib::AdaptationCommand msg;
-                    msg.source = ros::this_node::getName();
-                    msg.target = it->first;
-                    msg.action = "freq=" + std::to_string(freq[(it->first)]);
-                    adapt.publish(msg);
-                }
-            }*/
-            //double new_freq = freq[component] + ((error>0) ? ((-kp[component]/100) * error) : ((kp[component]/100) * error)); 
-            double new_freq = freq[component] + ((kp[component]/100) * error);
-            if(new_freq > 0) {
-                freq[component] = new_freq;
-                archlib::AdaptationCommand msg;
-                msg.source = ros::this_node::getName();
-                msg.target = component;
-                msg.action = "freq=" + std::to_string(freq[component]);
-                adapt.publish(msg);
-                /*std::cout << "################################################" << std::endl;
-                std::cout << "Adapting Centralhub" << std::endl;
-                std::cout << "Action: " << msg.action << std::endl;
-                std::cout << "################################################" << std::endl;*/
-            } /*else {
-                std::cout << "################################################" << std::endl;
-                std::cout << "COULD NOT ADAPT CENTRALHUB"<< std::endl;
-                std::cout << "Calculated frequency: " << new_freq << std::endl;
-                std::cout << "################################################" << std::endl;
-            }*/
-        } else {
-            if(adaptation_parameter == "replicate_collect") {
-                replicate_task[component] += (error > 0) ? ceil(kp[component] * error) : floor(kp[component] * error);
-                if (replicate_task[component] < 1) replicate_task[component] = 1;
-                archlib::AdaptationCommand msg;
-                msg.source = ros::this_node::getName();
-                msg.target = component;
-                msg.action = "replicate_collect=" + std::to_string(replicate_task[(component)]);
-                adapt.publish(msg);
-            } else {
-                //freq[component] += (error>0) ? ((-kp[component]/100) * error) : ((kp[component]/100) * error); 
-                //double new_freq = freq[component] + ((error>0) ? ((-kp[component]/100) * error) : ((kp[component]/100) * error));
-                double new_freq = freq[component] + ((kp[component]/100) * error);
-                if(new_freq >= 0.5 && new_freq <= 25) {
-                    freq[component] = new_freq;
-                    archlib::AdaptationCommand msg;
-                    msg.source = ros::this_node::getName();
-                    msg.target = component;
-                    msg.action = "freq=" + std::to_string(freq[component]);
-                    adapt.publish(msg);
-                }
-            }
-        }
-    } else {
-        exception_buffer[component] = (exception_buffer[component] > 0) ? 0 : exception_buffer[component] - 1;
-    }
+    enact(component, cost_control.step(component == "/g4t1", adaptation_parameter == "replicate_collect",
+                                       c_ref[component], c_curr[component], kp[component],
+                                       freq[component], replicate_task[component], exception_buffer[component]));
+}
 
-    if(exception_buffer[component]>4){
-        archlib::Exception msg;
+void Controller::enact(const std::string &component, const bsn::control::ControlAction &action) {
+    if (action.command != bsn::control::ControlAction::NONE) {
+        archlib::AdaptationCommand msg;
         msg.source = ros::this_node::getName();
-        msg.target = "/engine";
-        msg.content = component+"=1";
-        except.publish(msg);
-        exception_buffer[component] = 0;
-    } else if (exception_buffer[component]<-4) {
+        msg.target = component;
+        arch::addParameter(msg, (action.command == bsn::control::ControlAction::FREQ) ? archlib::AdaptationCommand::FREQ
+                                                                                       : archlib::AdaptationCommand::REPLICATE_COLLECT, action.value);
+        commands.commands.push_back(msg);
+    }
+
+    if (action.exception != 0) {
         archlib::Exception msg;
         msg.source = ros::this_node::getName();
         msg.target = "/engine";
-        msg.content = component+"=-1";
+        msg.content = component + ((action.exception > 0) ? "=1" : "=-1");
         except.publish(msg);
-        exception_buffer[component] = 0;
     }
     
     invocations[component].clear();
-}
\ No newline at end of file
+}
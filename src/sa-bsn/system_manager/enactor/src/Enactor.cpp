@@ -1,7 +1,7 @@
 #include "enactor/Enactor.hpp"
 #define W(x) std::cerr << #x << " = " << x << std::endl;
 
-Enactor::Enactor(int &argc, char **argv, std::string name) : ROSComponent(argc, argv, name), cycles(0), stability_margin(0.02) {}
+Enactor::Enactor(int &argc, char **argv, std::string name) : ROSComponent(argc, argv, name), commands(), trace(), cycles(0), stability_margin(0.02) {}
 
 Enactor::~Enactor() {}
 
@@ -51,35 +51,57 @@ void Enactor::receiveStatus() {
         ROS_ERROR("Received empty answer when asked for status.");
     }
 
-    std::vector<std::string> pairs = bsn::utils::split(ans, ';');
+    bsn::utils::StringView name, content;
 
-    for (auto s : pairs) {
-        std::vector<std::string> pair = bsn::utils::split(s, ':');
-        std::string component = pair[0];
-        std::string content = pair[1];
+    for (bsn::utils::StringView pair : bsn::utils::Tokenizer(ans, ';')) {
+        if (!bsn::utils::split_once(pair, ':', name, content)) continue;
+        std::string component = name.str();
 
-        std::vector<std::string> values = bsn::utils::split(content, ',');
+        // the latest value is the last one
+        bsn::utils::StringView last;
+        for (bsn::utils::StringView value : bsn::utils::Tokenizer(content, ',')) last = value;
 
         if(adaptation_parameter == "reliability") {
-            r_curr[component] = stod(values[values.size() - 1]);
+            r_curr[component] = bsn::utils::to_double(last);
             apply_reli_strategy(component);
         } else {
-            c_curr[component] = stod(values[values.size() - 1]);
+            c_curr[component] = bsn::utils::to_double(last);
             apply_cost_strategy(component);
         }
     }
+
+    sendAdaptationCommands();
+}
+
+void Enactor::sendAdaptationCommands() {
+    if (commands.commands.empty()) return;
+
+    // stamped once for the whole cycle, the components measure the actuation latency from it
+    commands.Header.stamp = ros::Time::now();
+    commands.Header.frame_id = trace;
+    commands.source = ros::this_node::getName();
+    for (archlib::AdaptationCommand &command : commands.commands) {
+        command.Header = commands.Header;
+    }
+    tracer.record(trace, "command");
+    adapt.publish(commands);
+    commands.commands.clear();
+    trace.clear();
 }
 
 void Enactor::receiveStrategy(const archlib::Strategy::ConstPtr& msg) {     
+    tracer.record(msg->Header, "enactor");
+    trace = msg->Header.frame_id;
+
+    bsn::utils::StringView component, value;
 
-    std::vector<std::string> refs = bsn::utils::split(msg->content, ';');
+    for (bsn::utils::StringView ref : bsn::utils::Tokenizer(msg->content, ';')) {
+        if (!bsn::utils::split_once(ref, ':', component, value)) continue;
 
-    for(std::vector<std::string>::iterator ref = refs.begin(); ref != refs.end(); ref++){
-        std::vector<std::string> pair = bsn::utils::split(*ref, ':'); 
         if(adaptation_parameter == "reliability") {
-            r_ref[pair[0]] = stod(pair[1]);
+            r_ref[component.str()] = bsn::utils::to_double(value);
         } else {
-            c_ref[pair[0]] = stod(pair[1]);
+            c_ref[component.str()] = bsn::utils::to_double(value);
         }
     }
 }
@@ -90,12 +112,16 @@ void Enactor::body(){
     ros::Subscriber subs_event = n.subscribe("event", 1000, &Enactor::receiveEvent, this);
     ros::Subscriber subs_strategy = n.subscribe("strategy", 1000, &Enactor::receiveStrategy, this);
 
-    ros::Rate loop_rate(rosComponentDescriptor.getFreq());
     while(ros::ok()){
+        perf.mark(arch::PerfCounters::BODY);
         if(cycles <= 60*rosComponentDescriptor.getFreq()) ++cycles;
         receiveStatus();
+        perf.mark(arch::PerfCounters::SPIN);
         ros::spinOnce();
-        loop_rate.sleep();
+        perf.backlog(!ros::getGlobalCallbackQueue()->isEmpty());
+        perf.mark(arch::PerfCounters::SLEEP);
+        waitNextCycle();
+        endCycle(loop.getFreq());
     }
 }
 
@@ -1,6 +1,6 @@
-#include "component/g3t1_1/G3T1_1.hpp"
+#include "component/g3t1/G3T1.hpp"
 
-int main(int argc, char **argv) {
-    G3T1_1 g3t1_1(argc, argv, "oximeter");
+int32_t main(int32_t argc, char **argv) {
+    G3T1 g3t1_1(argc, argv, "oximeter", "oximeter", "oxigenation", bsn::resource::Battery(G3T1::batteryId("oximeter"), 100, 100, 1));
     return g3t1_1.run();
-}
\ No newline at end of file
+}
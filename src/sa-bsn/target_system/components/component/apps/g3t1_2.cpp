@@ -1,6 +1,6 @@
-#include "component/g3t1_2/G3T1_2.hpp"
+#include "component/g3t1/G3T1.hpp"
 
 int32_t main(int32_t argc, char **argv) {
-    G3T1_2 g3t1_2(argc, argv, "ecg");
+    G3T1 g3t1_2(argc, argv, "ecg", "ecg", "heart_rate", bsn::resource::Battery(G3T1::batteryId("ecg"), 100, 100, 1));
     return g3t1_2.run();
-}
\ No newline at end of file
+}
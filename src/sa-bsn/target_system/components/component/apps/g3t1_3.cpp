@@ -1,6 +1,6 @@
-#include "component/g3t1_3/G3T1_3.hpp"
+#include "component/g3t1/G3T1.hpp"
 
 int32_t main(int32_t argc, char **argv) {
-    G3T1_3 g3t1_3(argc, argv, "thermometer");
+    G3T1 g3t1_3(argc, argv, "thermometer", "thermometer", "temperature", bsn::resource::Battery(G3T1::batteryId("thermometer"), 100, 100, 1));
     return g3t1_3.run();
-}
\ No newline at end of file
+}
@@ -1,6 +1,6 @@
-#include "component/g3t1_4/G3T1_4.hpp"
+#include "component/g3t1/G3T1.hpp"
 
 int32_t main(int32_t argc, char **argv) {
-    G3T1_4 g3t1_4(argc, argv, "abps");
+    G3T1 g3t1_4(argc, argv, "abps", "abps", "abps", bsn::resource::Battery(G3T1::batteryId("abps"), 100, 100, 1));
     return g3t1_4.run();
-}
\ No newline at end of file
+}
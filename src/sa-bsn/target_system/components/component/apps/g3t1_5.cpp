@@ -1,6 +1,6 @@
-#include "component/g3t1_5/G3T1_5.hpp"
+#include "component/g3t1/G3T1.hpp"
 
 int32_t main(int32_t argc, char **argv) {
-    G3T1_5 g3t1_5(argc, argv, "apbd");
+    G3T1 g3t1_5(argc, argv, "abpd", "abpd", "abpd", bsn::resource::Battery(G3T1::batteryId("abpd"), 100, 100, 1));
     return g3t1_5.run();
-}
\ No newline at end of file
+}
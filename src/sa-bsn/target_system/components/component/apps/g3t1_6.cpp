@@ -1,6 +1,6 @@
-#include "component/g3t1_6/G3T1_6.hpp"
+#include "component/g3t1/G3T1.hpp"
 
 int32_t main(int32_t argc, char **argv) {
-    G3T1_6 g3t1_6(argc, argv, "glucosemeter");
+    G3T1 g3t1_6(argc, argv, "glucosemeter", "glucosemeter", "glucose", bsn::resource::Battery(G3T1::batteryId("glucosemeter"), 100, 100, 1));
     return g3t1_6.run();
 }
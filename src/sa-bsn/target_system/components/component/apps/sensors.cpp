@@ -0,0 +1,42 @@
+#include <thread>
+#include <memory>
+#include <algorithm>
+
+#include "component/g3t1/G3T1.hpp"
+
+/*
+ * Hosts several vital sign sensors in a single process, one thread each.
+ * The sensors keep their own names and topics (reconfigure_/g3t1_1, ...)
+ * and read their parameters from the private namespace ~<sensor>/.
+ */
+int32_t main(int32_t argc, char **argv) {
+    ros::init(argc, argv, "sensors", ros::init_options::NoSigintHandler);
+
+    ros::NodeHandle config("~");
+    std::string names;
+    config.getParam("sensors", names);
+    names.erase(std::remove(names.begin(), names.end(), ' '), names.end());
+
+    std::vector<std::shared_ptr<G3T1>> sensors;
+    for (const std::string &name : bsn::utils::split(names, ',')) {
+        std::string type, vital_sign;
+
+        if (!config.getParam(name + "/type", type) || !config.getParam(name + "/vital_sign", vital_sign)) {
+            ROS_ERROR("Missing type or vital_sign for sensor %s", name.c_str());
+            continue;
+        }
+
+        sensors.push_back(std::make_shared<G3T1>(name, type, vital_sign, bsn::resource::Battery(G3T1::batteryId(type), 100, 100, 1)));
+    }
+
+    std::vector<std::thread> threads;
+    for (const std::shared_ptr<G3T1> &sensor : sensors) {
+        threads.push_back(std::thread(&G3T1::run, sensor.get()));
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    return 0;
+}
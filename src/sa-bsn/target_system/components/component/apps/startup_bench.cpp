@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+
+#include "archlib/target_system/Component.hpp"
+
+/*
+ * Starts N components in a single process, one thread each, and measures
+ * how long each one takes to reach its first cycle (its first sample)
+ * and how much CPU the process burns in the meantime. Components wait
+ * for the probe before their first cycle, so run it next to one, or start
+ * the probe a while after it to see what the wait costs. Their setUp also
+ * registers them in the effector, waiting up to startup_timeout s for its
+ * EffectorRegister service, so the effector should be running as well:
+ *
+ *   rosrun component startup_bench _components:=50
+ */
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    class StartupProbe : public arch::target_system::Component {
+
+        public:
+            StartupProbe(const std::string &name, std::atomic<int> &sampled) : Component(name), first(), done(false), sampled(sampled) {}
+
+            void body() {
+                if (done) return;
+
+                first = Clock::now();
+                done = true;
+                ++sampled;
+            }
+
+            Clock::time_point first;
+
+        private:
+            bool done;
+            std::atomic<int> &sampled;
+    };
+
+    double cpuTime() {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+    }
+}
+
+int32_t main(int32_t argc, char **argv) {
+    ros::init(argc, argv, "startup_bench", ros::init_options::NoSigintHandler);
+
+    ros::NodeHandle config("~");
+    int n = 10;
+    config.getParam("components", n);
+    if (n <= 0) {
+        std::cerr << "components must be positive, got " << n << std::endl;
+        return 1;
+    }
+
+    std::atomic<int> sampled(0);
+    std::vector<std::shared_ptr<StartupProbe>> components;
+    for (int i = 0; i < n; ++i) {
+        components.push_back(std::make_shared<StartupProbe>("startup_bench_" + std::to_string(i), sampled));
+    }
+
+    double cpu_start = cpuTime();
+    Clock::time_point start = Clock::now();
+
+    std::vector<std::thread> threads;
+    for (const std::shared_ptr<StartupProbe> &component : components) {
+        threads.push_back(std::thread(&StartupProbe::run, component.get()));
+    }
+
+    while (sampled < n && ros::ok()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    double wall = std::chrono::duration<double>(Clock::now() - start).count();
+    double cpu = cpuTime() - cpu_start;
+
+    ros::shutdown();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<double> first;
+    for (const std::shared_ptr<StartupProbe> &component : components) {
+        first.push_back(std::chrono::duration<double>(component->first - start).count());
+    }
+    std::sort(first.begin(), first.end());
+
+    double mean = 0;
+    for (double t : first) mean += t;
+    mean /= first.size();
+
+    std::cout << n << " components" << std::endl;
+    std::cout << "time to first sample (s): mean " << mean << ", median " << first[first.size() / 2] << ", max " << first.back() << std::endl;
+    std::cout << "cpu time until then (s): " << cpu << " (" << 100 * cpu / wall << "% of one core)" << std::endl;
+
+    return 0;
+}
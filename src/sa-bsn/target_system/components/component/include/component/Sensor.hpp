@@ -5,17 +5,22 @@
 #include <string>
 #include <vector>
 
+#include "ros/callback_queue.h"
+
 #include "archlib/target_system/Component.hpp"
 #include "archlib/AdaptationCommand.h"
 #include "archlib/Uncertainty.h"
 
 #include "libbsn/resource/Battery.hpp"
+#include "libbsn/generator/NoiseGenerator.hpp"
+#include "libbsn/random/Seed.hpp"
 #include "libbsn/utils/utils.hpp"
 
 class Sensor : public arch::target_system::Component {
 
     public:
 		Sensor(int &argc, char **argv, const std::string &name, const std::string &type, const bool &active, const double &noise_factor, const bsn::resource::Battery &battery, const bool &instant_recharge);
+		Sensor(const std::string &name, const std::string &type, const bool &active, const double &noise_factor, const bsn::resource::Battery &battery, const bool &instant_recharge);
     	~Sensor();
 
 	private:
@@ -47,11 +52,16 @@ class Sensor : public arch::target_system::Component {
         int buffer_size;
         int replicate_collect;
 		double noise_factor;
+		// each sensor draws its noise from its own stream, see the seed parameter
+		bsn::generator::NoiseGenerator noise;
 		bsn::resource::Battery battery;
         double data;
         bool instant_recharge;
         bool shouldStart;
         double cost;
+
+        // each sensor spins its own queue, so several of them can share one process
+        ros::CallbackQueue callback_queue;
 };
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef G3T1_HPP
+#define G3T1_HPP
+
+#include <string>
+#include <map>
+#include <memory>
+#include <exception>
+
+#include "ros/ros.h"
+
+#include "libbsn/resource/Battery.hpp"
+#include "libbsn/range/Range.hpp"
+#include "libbsn/filters/Filter.hpp"
+#include "libbsn/filters/MovingAverage.hpp"
+#include "libbsn/utils/utils.hpp"
+#include "libbsn/configuration/SensorConfiguration.hpp"
+
+#include "component/Sensor.hpp"
+
+#include "services/PatientData.h"
+#include "messages/SensorData.h"
+#include "messages/VitalSigns.h"
+
+/*
+ * Vital sign sensor (G3_T1.x tasks), parametrised by the sensor type
+ * (e.g. oximeter), which names the <type>_data topic, and by the vital
+ * sign it collects from the patient (e.g. oxigenation).
+ */
+class G3T1 : public Sensor {
+
+  	public:
+		G3T1(int &argc, char **argv, const std::string &name, const std::string &type, const std::string &vital_sign, const bsn::resource::Battery &battery);
+		G3T1(const std::string &name, const std::string &type, const std::string &vital_sign, const bsn::resource::Battery &battery);
+    	~G3T1();
+
+		// id of the battery of a sensor type (e.g. oxi_batt for an oximeter), the same
+		// whether the sensor runs on its own or among the others in one process
+		static std::string batteryId(const std::string &type);
+
+	private:
+      	G3T1(const G3T1 &);
+    	G3T1 &operator=(const G3T1 &);
+
+		std::string label(double &risk);
+		void receiveVitalSigns(const messages::VitalSigns::ConstPtr &msg);
+
+		template <typename T>
+		bool getParam(const std::string &key, T &value);
+
+	public:
+    	void setUp();
+    	void tearDown();
+
+        double collect();
+        double process(const double &data);
+        void transfer(const double &data);
+
+	  private:
+		std::string vital_sign;
+
+		std::unique_ptr<bsn::filters::Filter> filter;
+		bsn::configuration::SensorConfiguration sensorConfig;
+
+		// sensor specific parameters, looked up before the global ones
+		ros::NodeHandle config;
+		ros::Publisher data_pub;
+		ros::Subscriber vital_signs_sub;
+		
+		double collected_risk;
+
+		// latest sample streamed by the patient, consumed by collect()
+		double streamed_data;
+		bool has_streamed_data;
+};
+
+#endif 
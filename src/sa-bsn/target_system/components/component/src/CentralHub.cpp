@@ -1,5 +1,6 @@
 #include "component/CentralHub.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 CentralHub::CentralHub(int &argc, char **argv, const std::string &name, const bool &active, const bsn::resource::Battery &battery) : Component(argc, argv, name), active(active), max_size(20), total_buffer_size(0), buffer_size({0,0,0,0,0,0}), battery(battery), data_buffer({{0},{0},{0},{0},{0},{0}}) {}
@@ -18,17 +19,20 @@ int32_t CentralHub::run() {
     ros::Subscriber glucosemeterSub = nh.subscribe("glucosemeter_data", 10, &CentralHub::collect, this);
     ros::Subscriber reconfigSub = nh.subscribe("reconfigure_"+ros::this_node::getName(), 10, &CentralHub::reconfigure, this);
 
-    while(ros::ok()) {
-        ros::Rate loop_rate(rosComponentDescriptor.getFreq());
+    while(running()) {
+        perf.mark(arch::PerfCounters::BODY);
 
         try {
             body();
         } catch (const std::exception& e) {
             sendStatus("fail");
         }
-        loop_rate.sleep();
+        perf.mark(arch::PerfCounters::SLEEP);
+        waitNextCycle();
+        endCycle(loop.getFreq());
     }
 
+    if (interrupted) detach();
     return 0;
 }
 
@@ -58,20 +62,17 @@ void CentralHub::apply_noise() {}
 
 
 void CentralHub::reconfigure(const archlib::AdaptationCommand::ConstPtr& msg) {
-    std::string action = msg->action.c_str();
+    size_t size = std::min(msg->params.size(), msg->values.size());
 
-    std::vector<std::string> pairs = bsn::utils::split(action, ',');
-
-    for (std::vector<std::string>::iterator it = pairs.begin(); it != pairs.end(); ++it){
-        std::vector<std::string> param = bsn::utils::split(action, '=');
+    for (size_t i = 0; i < size; ++i) {
 
         // Why does replicate_collect updates frequency?
         /*if(param[0]=="replicate_collect"){
             rosComponentDescriptor.setFreq(rosComponentDescriptor.getFreq()+stoi(param[1]));
         }*/
-        if(param[0]=="freq"){
+        if(msg->params[i]==archlib::AdaptationCommand::FREQ){
             //double new_freq = rosComponentDescriptor.getFreq()+stoi(param[1]);
-            double new_freq = stod(param[1]);
+            double new_freq = msg->values[i];
             rosComponentDescriptor.setFreq(new_freq);
             /*std::cout << "@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@" << std::endl; 
             ROS_INFO("Calculated New Frequency: [%s]", std::to_string(new_freq).c_str());
@@ -79,6 +80,8 @@ void CentralHub::reconfigure(const archlib::AdaptationCommand::ConstPtr& msg) {
             std::cout << "@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@" << std::endl;*/
         }
     }
+
+    recordActuation(msg->Header);
 }
 
 bool CentralHub::isActive() {
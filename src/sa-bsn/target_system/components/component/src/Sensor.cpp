@@ -1,6 +1,10 @@
 #include "component/Sensor.hpp"
 
-Sensor::Sensor(int &argc, char **argv, const std::string &name, const std::string &type, const bool &active, const double &noise_factor, const bsn::resource::Battery &battery, const bool &instant_recharge) : Component(argc, argv, name), type(type), active(active), buffer_size(1), replicate_collect(1), noise_factor(0), battery(battery), data(0.0), instant_recharge(instant_recharge), cost(0.0) {}
+#include <algorithm>
+
+Sensor::Sensor(int &argc, char **argv, const std::string &name, const std::string &type, const bool &active, const double &noise_factor, const bsn::resource::Battery &battery, const bool &instant_recharge) : Component(argc, argv, name), type(type), active(active), buffer_size(1), replicate_collect(1), noise_factor(0), noise(bsn::random::seed_for(bsn::random::random_seed(), name)), battery(battery), data(0.0), instant_recharge(instant_recharge), shouldStart(true), cost(0.0) {}
+
+Sensor::Sensor(const std::string &name, const std::string &type, const bool &active, const double &noise_factor, const bsn::resource::Battery &battery, const bool &instant_recharge) : Component(name), type(type), active(active), buffer_size(1), replicate_collect(1), noise_factor(0), noise(bsn::random::seed_for(bsn::random::random_seed(), name)), battery(battery), data(0.0), instant_recharge(instant_recharge), shouldStart(true), cost(0.0) {}
 
 Sensor::~Sensor() {}
 
@@ -18,20 +22,24 @@ int32_t Sensor::run() {
 	setUp();
 
     if (!shouldStart) {
-        Component::shutdownComponent();
+        detach();
+        return 0;
     }
 
     ros::NodeHandle nh;
-    ros::Subscriber noise_subs = nh.subscribe("uncertainty_"+ros::this_node::getName(), 10, &Sensor::injectUncertainty, this);
-    ros::Subscriber reconfig_subs = nh.subscribe("reconfigure_"+ros::this_node::getName(), 10, &Sensor::reconfigure, this);
+    nh.setCallbackQueue(&callback_queue);
+    ros::Subscriber noise_subs = nh.subscribe("uncertainty_"+rosComponentDescriptor.getName(), 10, &Sensor::injectUncertainty, this);
+    ros::Subscriber reconfig_subs = nh.subscribe("reconfigure_"+rosComponentDescriptor.getName(), 10, &Sensor::reconfigure, this);
 
     sendStatus("init");
-    ros::spinOnce();
+    callback_queue.callAvailable();
     
-    while (ros::ok()) {
-        ros::Rate loop_rate(rosComponentDescriptor.getFreq());
-        ros::spinOnce();
+    while (running()) {
+        perf.mark(arch::PerfCounters::SPIN);
+        callback_queue.callAvailable();
+        perf.backlog(!callback_queue.isEmpty());
 
+        perf.mark(arch::PerfCounters::BODY);
         try {
             body();
         } catch (const std::exception& e) {
@@ -39,9 +47,12 @@ int32_t Sensor::run() {
             sendStatus("fail");
             cost = 0;
         } 
-        loop_rate.sleep();
+        perf.mark(arch::PerfCounters::SLEEP);
+        waitNextCycle();
+        endCycle(loop.getFreq());
     }
-    
+
+    if (interrupted) detach();
     return 0;
 }
 
@@ -59,15 +70,9 @@ void Sensor::body() {
         data = collect();
 
         /*for data replication, as if replicate_collect values were collected*/
-        {
-            double sum;
-            for(int i = 0; i < replicate_collect; ++i) {
-                double aux_data = data;
-                apply_noise(aux_data);
-                sum += aux_data;
-            }
-            data = sum/replicate_collect;
-        }
+        data = noise.replicate(data, noise_factor, replicate_collect);
+        // an injected noise lasts for one collection cycle, all of its replicas included
+        noise_factor = 0;
 
         data = process(data);
         transfer(data);
@@ -85,41 +90,32 @@ void Sensor::body() {
  * data +- [(error + rand(0,1)) * error] * data
  **/
 void Sensor::apply_noise(double &data) {
-    double offset = 0;
- 
-    offset = (noise_factor + ((double)rand() / RAND_MAX) * noise_factor) * data;
-    data += (rand()%2==0)?offset:(-1)*offset;
-    noise_factor = 0;
+    data = noise.apply(data, noise_factor);
 }
 
 void Sensor::reconfigure(const archlib::AdaptationCommand::ConstPtr& msg) {
-    std::string action = msg->action.c_str();
+    size_t size = std::min(msg->params.size(), msg->values.size());
 
-    std::vector<std::string> pairs = bsn::utils::split(action, ',');
-
-    for (std::vector<std::string>::iterator it = pairs.begin(); it != pairs.end(); ++it){
-        std::vector<std::string> param = bsn::utils::split(action, '=');
-
-        if(param[0]=="freq"){
-            double new_freq =  stod(param[1]);
-            rosComponentDescriptor.setFreq(new_freq);
-        } else if (param[0]=="replicate_collect") {
-            int new_replicate_collect = stoi(param[1]);
+    for (size_t i = 0; i < size; ++i) {
+        if(msg->params[i]==archlib::AdaptationCommand::FREQ){
+            rosComponentDescriptor.setFreq(msg->values[i]);
+        } else if (msg->params[i]==archlib::AdaptationCommand::REPLICATE_COLLECT) {
+            int new_replicate_collect = static_cast<int>(msg->values[i]);
             if(new_replicate_collect>1 && new_replicate_collect<200) replicate_collect = new_replicate_collect;
         }
     }
+
+    recordActuation(msg->Header);
 }
 
 void Sensor::injectUncertainty(const archlib::Uncertainty::ConstPtr& msg) {
-    std::string content = msg->content;
-
-    std::vector<std::string> pairs = bsn::utils::split(content, ',');
+    bsn::utils::StringView key, value;
 
-    for (std::vector<std::string>::iterator it = pairs.begin(); it != pairs.end(); ++it){
-        std::vector<std::string> param = bsn::utils::split(content, '=');
+    for (bsn::utils::StringView pair : bsn::utils::Tokenizer(msg->content, ',')) {
+        if (!bsn::utils::split_once(pair, '=', key, value)) continue;
 
-        if(param[0]=="noise_factor"){
-            noise_factor = stod(param[1]);
+        if(key=="noise_factor"){
+            noise_factor = bsn::utils::to_double(value);
         }
     }
 }
@@ -0,0 +1,230 @@
+#include "component/g3t1/G3T1.hpp"
+
+#define BATT_UNIT 0.05
+
+using namespace bsn::range;
+using namespace bsn::configuration;
+
+G3T1::G3T1(int &argc, char **argv, const std::string &name, const std::string &type, const std::string &vital_sign, const bsn::resource::Battery &battery) :
+    Sensor(argc, argv, name, type, true, 1, battery, false),
+    vital_sign(vital_sign),
+    filter(new bsn::filters::MovingAverage(1)),
+    sensorConfig(),
+    config("~"),
+    data_pub(),
+    vital_signs_sub(),
+    collected_risk(),
+    streamed_data(0),
+    has_streamed_data(false) {}
+
+G3T1::G3T1(const std::string &name, const std::string &type, const std::string &vital_sign, const bsn::resource::Battery &battery) :
+    Sensor(name, type, true, 1, battery, false),
+    vital_sign(vital_sign),
+    filter(new bsn::filters::MovingAverage(1)),
+    sensorConfig(),
+    config("~" + name),
+    data_pub(),
+    vital_signs_sub(),
+    collected_risk(),
+    streamed_data(0),
+    has_streamed_data(false) {}
+
+G3T1::~G3T1() {}
+
+std::string G3T1::batteryId(const std::string &type) {
+    static const std::map<std::string, std::string> ids = {
+        {"oximeter", "oxi_batt"},
+        {"ecg", "ecg_batt"},
+        {"thermometer", "therm_batt"},
+        {"abps", "abps_batt"},
+        {"abpd", "abpd_batt"},
+        {"glucosemeter", "glc_batt"}
+    };
+
+    std::map<std::string, std::string>::const_iterator it = ids.find(type);
+    return it != ids.end() ? it->second : type + "_batt";
+}
+
+template <typename T>
+bool G3T1::getParam(const std::string &key, T &value) {
+    return config.getParam(key, value) || handle.getParam(key, value);
+}
+
+void G3T1::setUp() {
+    Component::setUp();
+
+    std::string s;
+
+    std::array<bsn::range::Range,5> ranges;
+
+    getParam("start", shouldStart);
+
+    { // A given seed makes the noise of this sensor reproducible
+        int seed;
+        if (getParam("seed", seed)) noise = bsn::generator::NoiseGenerator(bsn::random::seed_for(seed, rosComponentDescriptor.getName()));
+    }
+    
+    { // Get ranges
+        std::vector<std::string> lrs,mrs0,hrs0,mrs1,hrs1;
+
+        getParam(vital_sign + "_LowRisk", s);
+        lrs = bsn::utils::split(s, ',');
+        getParam(vital_sign + "_MidRisk0", s);
+        mrs0 = bsn::utils::split(s, ',');
+        getParam(vital_sign + "_HighRisk0", s);
+        hrs0 = bsn::utils::split(s, ',');
+        getParam(vital_sign + "_MidRisk1", s);
+        mrs1 = bsn::utils::split(s, ',');
+        getParam(vital_sign + "_HighRisk1", s);
+        hrs1 = bsn::utils::split(s, ',');
+
+        ranges[0] = Range(std::stod(hrs0[0]), std::stod(hrs0[1]));
+        ranges[1] = Range(std::stod(mrs0[0]), std::stod(mrs0[1]));
+        ranges[2] = Range(std::stod(lrs[0]), std::stod(lrs[1]));
+        ranges[3] = Range(std::stod(mrs1[0]), std::stod(mrs1[1]));
+        ranges[4] = Range(std::stod(hrs1[0]), std::stod(hrs1[1]));
+    }
+
+    { // Configure sensor configuration
+        Range low_range = ranges[2];
+        
+        std::array<Range,2> midRanges;
+        midRanges[0] = ranges[1];
+        midRanges[1] = ranges[3];
+        
+        std::array<Range,2> highRanges;
+        highRanges[0] = ranges[0];
+        highRanges[1] = ranges[4];
+
+        std::array<Range,3> percentages;
+
+        getParam("lowrisk", s);
+        std::vector<std::string> low_p = bsn::utils::split(s, ',');
+        percentages[0] = Range(std::stod(low_p[0]), std::stod(low_p[1]));
+
+        getParam("midrisk", s);
+        std::vector<std::string> mid_p = bsn::utils::split(s, ',');
+        percentages[1] = Range(std::stod(mid_p[0]), std::stod(mid_p[1]));
+
+        getParam("highrisk", s);
+        std::vector<std::string> high_p = bsn::utils::split(s, ',');
+        percentages[2] = Range(std::stod(high_p[0]), std::stod(high_p[1]));
+
+        sensorConfig = SensorConfiguration(0, low_range, midRanges, highRanges, percentages);
+    }
+    
+    { // Configure the filter, a moving average over one sample unless told otherwise
+        std::string filter_type = "moving_average";
+        int filter_range = 1;
+
+        getParam("filter", filter_type);
+        getParam("filter_range", filter_range);
+
+        // make_filter takes an unsigned range, a negative one would be a huge window
+        if (filter_range < 1) {
+            ROS_ERROR("filter_range must be at least 1, got %d, filtering over one sample", filter_range);
+            filter_range = 1;
+        }
+
+        try {
+            filter = bsn::filters::make_filter(filter_type, filter_range);
+        } catch (const std::invalid_argument &e) {
+            ROS_ERROR("%s, using a moving average", e.what());
+            filter.reset(new bsn::filters::MovingAverage(filter_range));
+        }
+    }
+
+    { //Check for instant recharge parameter
+        getParam("instant_recharge", instant_recharge);
+    }
+
+    data_pub = handle.advertise<messages::SensorData>(type + "_data", 10);
+
+    ros::NodeHandle nh;
+    nh.setCallbackQueue(&callback_queue);
+    vital_signs_sub = nh.subscribe("vital_signs", 1, &G3T1::receiveVitalSigns, this);
+
+    // the first samples come from the patient, not from a failed call
+    waitForService("getPatientData");
+}
+
+void G3T1::receiveVitalSigns(const messages::VitalSigns::ConstPtr &msg) {
+    for (size_t i = 0; i < msg->vitalSigns.size() && i < msg->data.size(); ++i) {
+        if (msg->vitalSigns[i] == vital_sign) {
+            streamed_data = msg->data[i];
+            has_streamed_data = true;
+            return;
+        }
+    }
+}
+
+void G3T1::tearDown() {
+    Component::tearDown();
+}
+
+double G3T1::collect() {
+    double m_data = 0;
+
+    if (has_streamed_data) {
+        // fresh sample from the vital_signs stream, no need to call the patient
+        m_data = streamed_data;
+        has_streamed_data = false;
+        ROS_INFO("new data collected: [%s]", std::to_string(m_data).c_str());
+    } else {
+        ros::ServiceClient client = handle.serviceClient<services::PatientData>("getPatientData");
+        services::PatientData srv;
+
+        srv.request.vitalSign = vital_sign;
+
+        if (client.call(srv)) {
+            m_data = srv.response.data;
+            ROS_INFO("new data collected: [%s]", std::to_string(m_data).c_str());
+        } else {
+            ROS_INFO("error collecting data");
+        }
+    }
+
+    battery.consume(BATT_UNIT);
+    cost += BATT_UNIT;
+
+    collected_risk = sensorConfig.evaluateNumber(m_data);
+
+    return m_data;
+}
+
+double G3T1::process(const double &m_data) {
+    double filtered_data;
+    
+    filter->insert(m_data);
+    filtered_data = filter->getValue();
+    battery.consume(BATT_UNIT*filter->getRange());
+    cost += BATT_UNIT*filter->getRange();
+
+    ROS_INFO("filtered data: [%s]", std::to_string(filtered_data).c_str());
+    return filtered_data;
+}
+
+void G3T1::transfer(const double &m_data) {
+    double risk;
+    risk = sensorConfig.evaluateNumber(m_data);
+
+    if (risk < 0 || risk > 100) throw std::domain_error("risk data out of boundaries");
+    if (label(risk) != label(collected_risk)) throw std::domain_error("sensor accuracy fail");
+
+    // published by pointer so that subscribers in the same process get it without serialization
+    messages::SensorData::Ptr msg(new messages::SensorData);
+    msg->type = type;
+    msg->data = m_data;
+    msg->risk = risk;
+    msg->batt = battery.getCurrentLevel();
+
+    data_pub.publish(msg);
+    battery.consume(BATT_UNIT);
+    cost += BATT_UNIT;
+
+    ROS_INFO("risk calculated and transferred: [%.2f%%]", risk);
+}
+
+std::string G3T1::label(double &risk) {
+    return sensorConfig.label(risk);
+}
@@ -65,7 +65,7 @@ void G4T1::setUp() {
     ros::NodeHandle config;
 
     double freq;
-    config.getParam("frequency", freq);
+    getParam("frequency", freq);
     rosComponentDescriptor.setFreq(freq);
 
     for (std::vector<std::list<double>>::iterator it = data_buffer.begin();
@@ -8,6 +8,8 @@
 #include "archlib/EffectorRegister.h"
 #include "archlib/target_system/Effector.hpp"
 #include "archlib/AdaptationCommand.h"
+#include "archlib/AdaptationCommandSet.h"
+#include "archlib/AdaptationCommands.hpp"
 
 class ParamAdapter : public arch::target_system::Effector {
 
@@ -25,6 +27,7 @@ class ParamAdapter : public arch::target_system::Effector {
 		virtual void body();
 
         virtual void receiveAdaptationCommand(const archlib::AdaptationCommand::ConstPtr& msg);
+        virtual void receiveAdaptationCommands(const archlib::AdaptationCommandSet::ConstPtr& msg);
 		bool moduleConnect(archlib::EffectorRegister::Request &req, archlib::EffectorRegister::Response &res);
 
   	private:
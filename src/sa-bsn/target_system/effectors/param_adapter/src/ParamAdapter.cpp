@@ -7,7 +7,7 @@ void ParamAdapter::setUp() {
 	register_service = handle.advertiseService("EffectorRegister", &ParamAdapter::moduleConnect, this);
 			
 	double freq;
-	handle.getParam("frequency", freq);
+	getParam("frequency", freq);
 	rosComponentDescriptor.setFreq(freq);
 }
 
@@ -15,7 +15,7 @@ void ParamAdapter::tearDown() {}
 
 void ParamAdapter::body() {
 	ros::NodeHandle n;
-	ros::Subscriber reconf = n.subscribe("reconfigure", 1000, &ParamAdapter::receiveAdaptationCommand, this);
+	ros::Subscriber reconf = n.subscribe("reconfigure", 1000, &ParamAdapter::receiveAdaptationCommands, this);
 	ros::spin();
 
 }
@@ -28,6 +28,24 @@ void ParamAdapter::receiveAdaptationCommand(const archlib::AdaptationCommand::Co
 	}
 }
 
+/*
+ * Fans a cycle's batch out to the targets in one pass, with a single
+ * command per target that carries the latest value of each parameter.
+ */
+void ParamAdapter::receiveAdaptationCommands(const archlib::AdaptationCommandSet::ConstPtr& msg) {
+	tracer.record(msg->Header, "effector");
+
+	for (const archlib::AdaptationCommand &command : arch::coalesce(*msg)) {
+		std::map<std::string,ros::Publisher>::iterator target = target_arr.find(command.target);
+
+		if (target != target_arr.end()) {
+			target->second.publish(command);
+		} else {
+			ROS_INFO("ERROR, target not found! [%s]", command.target.c_str());
+		}
+	}
+}
+
 bool ParamAdapter::moduleConnect(archlib::EffectorRegister::Request &req, archlib::EffectorRegister::Response &res) {
 
 	try {